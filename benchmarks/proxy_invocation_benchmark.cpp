@@ -7,6 +7,8 @@
 
 namespace {
 
+using FunConvention = std::tuple_element_t<0u, InvocationTestFacade::convention_types>;
+
 void BM_SmallObjectInvocationViaProxy(benchmark::State& state) {
   auto data = GenerateSmallObjectInvocationProxyTestData();
   for (auto _ : state) {
@@ -17,6 +19,153 @@ void BM_SmallObjectInvocationViaProxy(benchmark::State& state) {
   }
 }
 
+template <int ConventionCount, bool InlineMeta>
+void SmallObjectMultiConventionInvocationImpl(benchmark::State& state) {
+  auto data = GenerateSmallObjectMultiConventionInvocationProxyTestData<
+      ConventionCount, InlineMeta>();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun(FunSlot<ConventionCount - 1>{});
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxy_1Convention_InlineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<1, true>(state); }
+
+void BM_SmallObjectInvocationViaProxy_1Convention_OutOfLineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<1, false>(state); }
+
+void BM_SmallObjectInvocationViaProxy_2Conventions_InlineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<2, true>(state); }
+
+void BM_SmallObjectInvocationViaProxy_2Conventions_OutOfLineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<2, false>(state); }
+
+void BM_SmallObjectInvocationViaProxy_4Conventions_InlineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<4, true>(state); }
+
+void BM_SmallObjectInvocationViaProxy_4Conventions_OutOfLineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<4, false>(state); }
+
+void BM_SmallObjectInvocationViaProxy_8Conventions_InlineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<8, true>(state); }
+
+void BM_SmallObjectInvocationViaProxy_8Conventions_OutOfLineMeta(benchmark::State& state)
+    { SmallObjectMultiConventionInvocationImpl<8, false>(state); }
+
+template <class F, int I>
+int InvokeWideConvention(const pro::proxy<F>& p) {
+  using C = std::tuple_element_t<I, typename F::convention_types>;
+  return pro::proxy_invoke<C, int(FunSlot<I>) const>(p, FunSlot<I>{});
+}
+
+template <bool MarkHot>
+void SmallObjectWideInvocationImpl(benchmark::State& state) {
+  using F = WideInvocationTestFacade<MarkHot>;
+  auto data = GenerateSmallObjectWideInvocationProxyTestData<MarkHot>();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = InvokeWideConvention<F, 0>(p) + InvokeWideConvention<F, 9>(p) +
+          InvokeWideConvention<F, 19>(p);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaProxy_20Conventions(benchmark::State& state)
+    { SmallObjectWideInvocationImpl<false>(state); }
+
+void BM_SmallObjectInvocationViaProxy_20Conventions_HotConventions(benchmark::State& state)
+    { SmallObjectWideInvocationImpl<true>(state); }
+
+void BM_SmallObjectInvocationViaClosedProxy(benchmark::State& state) {
+  auto data = GenerateSmallObjectInvocationClosedProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaIndexedProxy(benchmark::State& state) {
+  auto data = GenerateSmallObjectInvocationIndexedProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaPolyCollection(benchmark::State& state) {
+  const auto data = GenerateSmallObjectInvocationPolyCollectionTestData();
+  for (auto _ : state) {
+    data.invoke<FunConvention, int() const>();
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_SmallObjectInvocationViaPolyCollection_Results(benchmark::State& state) {
+  const auto data = GenerateSmallObjectInvocationPolyCollectionTestData();
+  std::vector<int> results(data.size());
+  for (auto _ : state) {
+    data.invoke_into<FunConvention, int() const>(results);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_SmallObjectInvocationViaPolyCollection_BulkResults(benchmark::State& state) {
+  using C = std::tuple_element_t<0u, BulkInvocationTestFacade::convention_types>;
+  const auto data = GenerateSmallObjectBulkInvocationPolyCollectionTestData();
+  std::vector<int> results(data.size());
+  for (auto _ : state) {
+    data.invoke_into<C, int() const>(results);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_SmallObjectInvocationViaProxyBatch(benchmark::State& state) {
+  auto data = GenerateSmallObjectInvocationProxyTestData();
+  for (auto _ : state) {
+    pro::proxy_invoke_batch<FunConvention, int() const>(data);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_SmallObjectInvocationViaGroupedProxyBatch(benchmark::State& state) {
+  auto data = GenerateSmallObjectInvocationProxyTestData();
+  pro::proxy_invoke_batch<FunConvention, int() const>(pro::group_by_type, data);
+  for (auto _ : state) {
+    pro::proxy_invoke_batch<FunConvention, int() const>(data);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_SmallObjectInvocationViaUpwardConversion(benchmark::State& state) {
+  auto data = GenerateSmallObjectInvocationLayeredProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      pro::proxy<LayeredInvocationTestBaseFacade> base = p;
+      int result = InvokeLayeredBase(base);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SmallObjectInvocationViaUpcast(benchmark::State& state) {
+  auto data = GenerateSmallObjectInvocationUpcastProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      pro::proxy<LayeredInvocationTestBaseFacade> base = p;
+      int result = InvokeLayeredBase(base);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
 void BM_SmallObjectInvocationViaVirtualFunction(benchmark::State& state) {
   auto data = GenerateSmallObjectInvocationVirtualFunctionTestData();
   for (auto _ : state) {
@@ -27,6 +176,37 @@ void BM_SmallObjectInvocationViaVirtualFunction(benchmark::State& state) {
   }
 }
 
+void BM_SkewedSmallObjectInvocationViaProxy(benchmark::State& state) {
+  auto data = GenerateSkewedSmallObjectInvocationProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SkewedSmallObjectInvocationViaProxyVisit(benchmark::State& state) {
+  auto data = GenerateSkewedSmallObjectInvocationProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = pro::proxy_visit<NonIntrusiveSmallImpl<0>, NonIntrusiveSmallImpl<1>, NonIntrusiveSmallImpl<2>>(
+          p, [](const auto& v) { return v.Fun(); }, [](const auto& q) { return q->Fun(); });
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_SkewedSmallObjectInvocationViaVirtualFunction(benchmark::State& state) {
+  auto data = GenerateSkewedSmallObjectInvocationVirtualFunctionTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
 void BM_LargeObjectInvocationViaProxy(benchmark::State& state) {
   auto data = GenerateLargeObjectInvocationProxyTestData();
   for (auto _ : state) {
@@ -37,6 +217,101 @@ void BM_LargeObjectInvocationViaProxy(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectInvocationViaEmbeddedProxy(benchmark::State& state) {
+  auto data = GenerateLargeObjectInvocationEmbeddedProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaProxy_Shuffled(benchmark::State& state) {
+  auto data = GenerateShuffledLargeObjectInvocationProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaProxy_Shuffled_Prefetched(benchmark::State& state) {
+  auto data = GenerateShuffledLargeObjectInvocationProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : pro::prefetched(data, 8)) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaViewableProxy(benchmark::State& state) {
+  auto data = GenerateLargeObjectInvocationViewableProxyTestData();
+  for (auto _ : state) {
+    for (auto& p : data) {
+      int result = p->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaProxyView(benchmark::State& state) {
+  auto data = GenerateLargeObjectInvocationViewableProxyTestData();
+  std::vector<pro::proxy_view<ViewableInvocationTestFacade>> views(data.begin(), data.end());
+  for (auto _ : state) {
+    for (auto& v : views) {
+      int result = v->Fun();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+}
+
+void BM_LargeObjectInvocationViaPolyCollection(benchmark::State& state) {
+  const auto data = GenerateLargeObjectInvocationPolyCollectionTestData();
+  for (auto _ : state) {
+    data.invoke<FunConvention, int() const>();
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_LargeObjectInvocationViaPolyCollection_Parallel(benchmark::State& state) {
+  const auto data = GenerateLargeObjectInvocationPolyCollectionTestData();
+  std::vector<int> results(data.size());
+  pro::parallel_t policy{static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    data.invoke_into<FunConvention, int() const>(policy, results);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_LargeObjectInvocationViaProxyBatch(benchmark::State& state) {
+  auto data = GenerateLargeObjectInvocationProxyTestData();
+  for (auto _ : state) {
+    pro::proxy_invoke_batch<FunConvention, int() const>(data);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_LargeObjectInvocationViaProxyBatch_Parallel(benchmark::State& state) {
+  auto data = GenerateLargeObjectInvocationProxyTestData();
+  pro::parallel_t policy{static_cast<std::size_t>(state.range(0))};
+  for (auto _ : state) {
+    pro::proxy_invoke_batch<FunConvention, int() const>(policy, data);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_LargeObjectInvocationViaGroupedProxyBatch(benchmark::State& state) {
+  auto data = GenerateLargeObjectInvocationProxyTestData();
+  pro::proxy_invoke_batch<FunConvention, int() const>(pro::group_by_type, data);
+  for (auto _ : state) {
+    pro::proxy_invoke_batch<FunConvention, int() const>(data);
+    benchmark::ClobberMemory();
+  }
+}
+
 void BM_LargeObjectInvocationViaVirtualFunction(benchmark::State& state) {
   auto data = GenerateLargeObjectInvocationVirtualFunctionTestData();
   for (auto _ : state) {
@@ -48,8 +323,40 @@ void BM_LargeObjectInvocationViaVirtualFunction(benchmark::State& state) {
 }
 
 BENCHMARK(BM_SmallObjectInvocationViaProxy);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_1Convention_InlineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_1Convention_OutOfLineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_2Conventions_InlineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_2Conventions_OutOfLineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_4Conventions_InlineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_4Conventions_OutOfLineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_8Conventions_InlineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_8Conventions_OutOfLineMeta);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_20Conventions);
+BENCHMARK(BM_SmallObjectInvocationViaProxy_20Conventions_HotConventions);
+BENCHMARK(BM_SmallObjectInvocationViaClosedProxy);
+BENCHMARK(BM_SmallObjectInvocationViaIndexedProxy);
+BENCHMARK(BM_SmallObjectInvocationViaPolyCollection);
+BENCHMARK(BM_SmallObjectInvocationViaPolyCollection_Results);
+BENCHMARK(BM_SmallObjectInvocationViaPolyCollection_BulkResults);
+BENCHMARK(BM_SmallObjectInvocationViaProxyBatch);
+BENCHMARK(BM_SmallObjectInvocationViaGroupedProxyBatch);
+BENCHMARK(BM_SmallObjectInvocationViaUpwardConversion);
+BENCHMARK(BM_SmallObjectInvocationViaUpcast);
 BENCHMARK(BM_SmallObjectInvocationViaVirtualFunction);
+BENCHMARK(BM_SkewedSmallObjectInvocationViaProxy);
+BENCHMARK(BM_SkewedSmallObjectInvocationViaProxyVisit);
+BENCHMARK(BM_SkewedSmallObjectInvocationViaVirtualFunction);
 BENCHMARK(BM_LargeObjectInvocationViaProxy);
+BENCHMARK(BM_LargeObjectInvocationViaEmbeddedProxy);
+BENCHMARK(BM_LargeObjectInvocationViaProxy_Shuffled);
+BENCHMARK(BM_LargeObjectInvocationViaProxy_Shuffled_Prefetched);
+BENCHMARK(BM_LargeObjectInvocationViaViewableProxy);
+BENCHMARK(BM_LargeObjectInvocationViaProxyView);
+BENCHMARK(BM_LargeObjectInvocationViaPolyCollection);
+BENCHMARK(BM_LargeObjectInvocationViaPolyCollection_Parallel)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_LargeObjectInvocationViaProxyBatch);
+BENCHMARK(BM_LargeObjectInvocationViaProxyBatch_Parallel)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_LargeObjectInvocationViaGroupedProxyBatch);
 BENCHMARK(BM_LargeObjectInvocationViaVirtualFunction);
 
 }  // namespace
@@ -3,21 +3,12 @@
 
 #include "proxy_invocation_benchmark_context.h"
 
+#include <algorithm>
+#include <random>
+
 namespace {
 
 constexpr int TestDataSize = 1000000;
-constexpr int TypeSeriesCount = 100;
-
-template <int TypeSeries>
-class NonIntrusiveSmallImpl {
- public:
-  explicit NonIntrusiveSmallImpl(int seed) noexcept : seed_(seed) {}
-  NonIntrusiveSmallImpl(const NonIntrusiveSmallImpl&) noexcept = default;
-  int Fun() const noexcept { return seed_ ^ (TypeSeries + 1); }
-
- private:
-  int seed_;
-};
 
 template <int TypeSeries>
 class NonIntrusiveLargeImpl {
@@ -67,6 +58,39 @@ void FillTestData(std::vector<T>& data, const F& generator) {
   }
 }
 
+template <int FromTypeSeries, class T, class F>
+void FillSkewedTestData(std::vector<T>& data, const std::vector<int>& types, const F& generator) {
+  if constexpr (FromTypeSeries < TypeSeriesCount) {
+    for (int i = 0; i < TestDataSize; ++i) {
+      if (types[i] == FromTypeSeries) {
+        data[i] = generator(IntConstant<FromTypeSeries>{}, i);
+      }
+    }
+    FillSkewedTestData<FromTypeSeries + 1>(data, types, generator);
+  }
+}
+
+// 95% of the objects are of the first SkewedHotTypeCount types, in short runs of
+// the same type
+template <class F>
+auto GenerateSkewedTestData(const F& generator) {
+  std::minstd_rand engine;
+  std::uniform_int_distribution<int> percentage(0, 99);
+  std::uniform_int_distribution<int> hot(0, SkewedHotTypeCount - 1);
+  std::uniform_int_distribution<int> cold(SkewedHotTypeCount, TypeSeriesCount - 1);
+  std::uniform_int_distribution<int> run_length(1, 32);
+  std::vector<int> types;
+  types.reserve(TestDataSize + 32);
+  while (types.size() < static_cast<std::size_t>(TestDataSize)) {
+    types.insert(types.end(), run_length(engine),
+        percentage(engine) < 95 ? hot(engine) : cold(engine));
+  }
+  types.resize(TestDataSize);
+  std::vector<decltype(generator(IntConstant<0>{}, 0))> result(TestDataSize);
+  FillSkewedTestData<0>(result, types, generator);
+  return result;
+}
+
 template <class F>
 auto GenerateTestData(const F& generator) {
   std::vector<decltype(generator(IntConstant<0>{}, 0))> result(TestDataSize);
@@ -74,12 +98,47 @@ auto GenerateTestData(const F& generator) {
   return result;
 }
 
+template <template <int> class T, int FromTypeSeries = 0, class F>
+void FillPolyCollectionTestData(pro::poly_collection<F>& data) {
+  if constexpr (FromTypeSeries < TypeSeriesCount) {
+    for (int i = FromTypeSeries; i < TestDataSize; i += TypeSeriesCount) {
+      data.template emplace<T<FromTypeSeries>>(i);
+    }
+    FillPolyCollectionTestData<T, FromTypeSeries + 1>(data);
+  }
+}
+
 }  // namespace
 
 std::vector<pro::proxy<InvocationTestFacade>> GenerateSmallObjectInvocationProxyTestData() {
   return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
       { return pro::make_proxy<InvocationTestFacade, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
 }
+std::vector<pro::proxy<LayeredInvocationTestFacade>> GenerateSmallObjectInvocationLayeredProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<LayeredInvocationTestFacade, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
+std::vector<pro::proxy<UpcastInvocationTestFacade>> GenerateSmallObjectInvocationUpcastProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<UpcastInvocationTestFacade, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
+int InvokeLayeredBase(const pro::proxy<LayeredInvocationTestBaseFacade>& p) { return p->Fun(); }
+std::vector<pro::proxy<InvocationTestFacade>> GenerateSkewedSmallObjectInvocationProxyTestData() {
+  return GenerateSkewedTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<InvocationTestFacade, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
+std::vector<std::unique_ptr<InvocationTestBase>> GenerateSkewedSmallObjectInvocationVirtualFunctionTestData() {
+  return GenerateSkewedTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return std::unique_ptr<InvocationTestBase>{new IntrusiveSmallImpl<TypeSeries>(seed)}; });
+}
+std::vector<pro::proxy<ClosedInvocationTestFacade>> GenerateSmallObjectInvocationClosedProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<ClosedInvocationTestFacade, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
+std::vector<pro::proxy<IndexedInvocationTestFacade>> GenerateSmallObjectInvocationIndexedProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<IndexedInvocationTestFacade, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
 std::vector<std::unique_ptr<InvocationTestBase>> GenerateSmallObjectInvocationVirtualFunctionTestData() {
   return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
       { return std::unique_ptr<InvocationTestBase>{new IntrusiveSmallImpl<TypeSeries>(seed)}; });
@@ -88,7 +147,57 @@ std::vector<pro::proxy<InvocationTestFacade>> GenerateLargeObjectInvocationProxy
   return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
       { return pro::make_proxy<InvocationTestFacade, NonIntrusiveLargeImpl<TypeSeries>>(seed); });
 }
+std::vector<pro::proxy<InvocationTestFacade>> GenerateShuffledLargeObjectInvocationProxyTestData() {
+  auto result = GenerateLargeObjectInvocationProxyTestData();
+  std::shuffle(result.begin(), result.end(), std::minstd_rand{});
+  return result;
+}
 std::vector<std::unique_ptr<InvocationTestBase>> GenerateLargeObjectInvocationVirtualFunctionTestData() {
   return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
       { return std::unique_ptr<InvocationTestBase>{new IntrusiveLargeImpl<TypeSeries>(seed)}; });
 }
+std::vector<pro::proxy<ViewableInvocationTestFacade>> GenerateLargeObjectInvocationViewableProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<ViewableInvocationTestFacade, NonIntrusiveLargeImpl<TypeSeries>>(seed); });
+}
+std::vector<pro::proxy<EmbeddedInvocationTestFacade>> GenerateLargeObjectInvocationEmbeddedProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<EmbeddedInvocationTestFacade, NonIntrusiveLargeImpl<TypeSeries>>(seed); });
+}
+template <int ConventionCount, bool InlineMeta>
+std::vector<pro::proxy<MultiConventionInvocationTestFacade<ConventionCount, InlineMeta>>>
+    GenerateSmallObjectMultiConventionInvocationProxyTestData() {
+  using F = MultiConventionInvocationTestFacade<ConventionCount, InlineMeta>;
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<F, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<1, false>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<1, false>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<1, true>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<1, true>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<2, false>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<2, false>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<2, true>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<2, true>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<4, false>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<4, false>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<4, true>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<4, true>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<8, false>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<8, false>();
+template std::vector<pro::proxy<MultiConventionInvocationTestFacade<8, true>>> GenerateSmallObjectMultiConventionInvocationProxyTestData<8, true>();
+template <bool MarkHot>
+std::vector<pro::proxy<WideInvocationTestFacade<MarkHot>>> GenerateSmallObjectWideInvocationProxyTestData() {
+  return GenerateTestData([]<int TypeSeries>(IntConstant<TypeSeries>, int seed)
+      { return pro::make_proxy<WideInvocationTestFacade<MarkHot>, NonIntrusiveSmallImpl<TypeSeries>>(seed); });
+}
+template std::vector<pro::proxy<WideInvocationTestFacade<false>>> GenerateSmallObjectWideInvocationProxyTestData<false>();
+template std::vector<pro::proxy<WideInvocationTestFacade<true>>> GenerateSmallObjectWideInvocationProxyTestData<true>();
+pro::poly_collection<InvocationTestFacade> GenerateSmallObjectInvocationPolyCollectionTestData() {
+  pro::poly_collection<InvocationTestFacade> result;
+  FillPolyCollectionTestData<NonIntrusiveSmallImpl>(result);
+  return result;
+}
+pro::poly_collection<InvocationTestFacade> GenerateLargeObjectInvocationPolyCollectionTestData() {
+  pro::poly_collection<InvocationTestFacade> result;
+  FillPolyCollectionTestData<NonIntrusiveLargeImpl>(result);
+  return result;
+}
+pro::poly_collection<BulkInvocationTestFacade> GenerateSmallObjectBulkInvocationPolyCollectionTestData() {
+  pro::poly_collection<BulkInvocationTestFacade> result;
+  FillPolyCollectionTestData<NonIntrusiveSmallImpl>(result);
+  return result;
+}
@@ -2,15 +2,130 @@
 // Licensed under the MIT License.
 
 #include <memory>
+#include <span>
+#include <utility>
 #include <vector>
 
+#define PRO_ENABLE_PARALLEL
 #include "proxy.h"
 
 PRO_DEF_MEM_DISPATCH(MemFun, Fun);
 
-struct InvocationTestFacade : pro::facade_builder
-    ::add_convention<MemFun, int() const>
-    ::build{};
+constexpr int TypeSeriesCount = 100;
+constexpr int SkewedHotTypeCount = 3;
+
+template <int I>
+struct FunSlot {};
+
+template <int TypeSeries>
+class NonIntrusiveSmallImpl {
+ public:
+  explicit NonIntrusiveSmallImpl(int seed) noexcept : seed_(seed) {}
+  NonIntrusiveSmallImpl(const NonIntrusiveSmallImpl&) noexcept = default;
+  int Fun() const noexcept { return seed_ ^ (TypeSeries + 1); }
+  template <int I>
+  int Fun(FunSlot<I>) const noexcept { return seed_ ^ (TypeSeries + I + 1); }
+
+ private:
+  int seed_;
+};
+
+PRO_DEF_FREE_DISPATCH(FreeFunAll, FunAll);
+
+template <int TypeSeries>
+int FunAll(const NonIntrusiveSmallImpl<TypeSeries>& self) noexcept { return self.Fun(); }
+
+template <int TypeSeries>
+void FunAll(std::span<const NonIntrusiveSmallImpl<TypeSeries>> self, std::span<int> results) noexcept {
+  for (std::size_t i = 0; i < self.size(); ++i) {
+    results[i] = self[i].Fun();
+  }
+}
+
+using InvocationTestFacadeBuilder = pro::facade_builder
+    ::add_convention<MemFun, int() const>;
+
+template <class Is>
+struct ClosedInvocationTestFacadeBuilder;
+template <int... Is>
+struct ClosedInvocationTestFacadeBuilder<std::integer_sequence<int, Is...>>
+    : std::type_identity<InvocationTestFacadeBuilder
+          ::restrict_types<NonIntrusiveSmallImpl<Is>...>> {};
+
+struct InvocationTestFacade : InvocationTestFacadeBuilder::build{};
+
+struct ViewableInvocationTestFacade : InvocationTestFacadeBuilder
+    ::add_view<ViewableInvocationTestFacade>
+    ::build {};
+
+struct LayeredInvocationTestBaseFacade : InvocationTestFacadeBuilder
+    ::support_copy<pro::constraint_level::nothrow>
+    ::build {};
+
+// Extends the base facade with another overload. A proxy of it is converted to
+// a proxy of the base via upward conversion
+struct LayeredInvocationTestFacade : pro::facade_builder
+    ::add_facade<LayeredInvocationTestBaseFacade, true>
+    ::add_convention<MemFun, int(FunSlot<0>) const>
+    ::build {};
+
+// Same as LayeredInvocationTestFacade, but without upward conversion, so that a
+// proxy of it is converted to a proxy of the base by sharing the meta
+struct UpcastInvocationTestFacade : pro::facade_builder
+    ::add_facade<LayeredInvocationTestBaseFacade>
+    ::add_convention<MemFun, int(FunSlot<0>) const>
+    ::build {};
+
+struct BulkInvocationTestFacade : pro::facade_builder
+    ::add_bulk_convention<FreeFunAll, int() const>
+    ::build {};
+
+// 8 bytes per proxy: a 32-bit meta index and a 4-byte inline object
+struct IndexedInvocationTestFacade : InvocationTestFacadeBuilder
+    ::restrict_layout<4>
+    ::support_indexed_meta
+    ::build {};
+
+// 8 bytes per proxy: the meta is referenced from the header of the allocation
+struct EmbeddedInvocationTestFacade : InvocationTestFacadeBuilder
+    ::support_embedded_meta
+    ::build {};
+
+struct ClosedInvocationTestFacade : ClosedInvocationTestFacadeBuilder<
+    std::make_integer_sequence<int, TypeSeriesCount>>::type::build{};
+
+template <class Is>
+struct MultiConventionInvocationTestFacadeBuilder;
+template <int... Is>
+struct MultiConventionInvocationTestFacadeBuilder<std::integer_sequence<int, Is...>>
+    : std::type_identity<pro::facade_builder
+          ::add_convention<MemFun, int(FunSlot<Is>) const...>> {};
+
+// Each overload takes one dispatcher slot in the meta, in addition to the 2
+// slots for relocation and destruction
+template <int ConventionCount, bool InlineMeta>
+struct MultiConventionInvocationTestFacade : MultiConventionInvocationTestFacadeBuilder<
+    std::make_integer_sequence<int, ConventionCount>>::type
+    ::template support_inline_meta<InlineMeta ? ConventionCount + 2 : 0>::build {};
+
+template <int I>
+struct MemFunAt : MemFun {};
+
+// A facade with 20 conventions, of which the benchmarks only invoke 3
+constexpr int WideConventionCount = 20;
+template <int I>
+constexpr bool IsInvokedWideConvention = I == 0 || I == 9 || I == 19;
+
+template <bool MarkHot, class B = pro::facade_builder, int I = 0>
+struct WideInvocationTestFacadeBuilder : WideInvocationTestFacadeBuilder<MarkHot, std::conditional_t<
+    MarkHot && IsInvokedWideConvention<I>,
+    typename B::template add_hot_convention<MemFunAt<I>, int(FunSlot<I>) const>,
+    typename B::template add_convention<MemFunAt<I>, int(FunSlot<I>) const>>, I + 1> {};
+template <bool MarkHot, class B>
+struct WideInvocationTestFacadeBuilder<MarkHot, B, WideConventionCount> : std::type_identity<B> {};
+
+template <bool MarkHot>
+struct WideInvocationTestFacade : WideInvocationTestFacadeBuilder<MarkHot>::type::build {};
 
 struct InvocationTestBase {
   virtual int Fun() const = 0;
@@ -18,6 +133,26 @@ struct InvocationTestBase {
 };
 
 std::vector<pro::proxy<InvocationTestFacade>> GenerateSmallObjectInvocationProxyTestData();
+std::vector<pro::proxy<ClosedInvocationTestFacade>> GenerateSmallObjectInvocationClosedProxyTestData();
+std::vector<pro::proxy<IndexedInvocationTestFacade>> GenerateSmallObjectInvocationIndexedProxyTestData();
+std::vector<pro::proxy<LayeredInvocationTestFacade>> GenerateSmallObjectInvocationLayeredProxyTestData();
+std::vector<pro::proxy<UpcastInvocationTestFacade>> GenerateSmallObjectInvocationUpcastProxyTestData();
+int InvokeLayeredBase(const pro::proxy<LayeredInvocationTestBaseFacade>& p);
+std::vector<pro::proxy<InvocationTestFacade>> GenerateSkewedSmallObjectInvocationProxyTestData();
+std::vector<std::unique_ptr<InvocationTestBase>> GenerateSkewedSmallObjectInvocationVirtualFunctionTestData();
 std::vector<std::unique_ptr<InvocationTestBase>> GenerateSmallObjectInvocationVirtualFunctionTestData();
 std::vector<pro::proxy<InvocationTestFacade>> GenerateLargeObjectInvocationProxyTestData();
+// Same as GenerateLargeObjectInvocationProxyTestData(), but the proxies are shuffled so that
+// the objects are visited in an order unrelated to their addresses
+std::vector<pro::proxy<InvocationTestFacade>> GenerateShuffledLargeObjectInvocationProxyTestData();
 std::vector<std::unique_ptr<InvocationTestBase>> GenerateLargeObjectInvocationVirtualFunctionTestData();
+std::vector<pro::proxy<ViewableInvocationTestFacade>> GenerateLargeObjectInvocationViewableProxyTestData();
+std::vector<pro::proxy<EmbeddedInvocationTestFacade>> GenerateLargeObjectInvocationEmbeddedProxyTestData();
+template <int ConventionCount, bool InlineMeta>
+std::vector<pro::proxy<MultiConventionInvocationTestFacade<ConventionCount, InlineMeta>>>
+    GenerateSmallObjectMultiConventionInvocationProxyTestData();
+template <bool MarkHot>
+std::vector<pro::proxy<WideInvocationTestFacade<MarkHot>>> GenerateSmallObjectWideInvocationProxyTestData();
+pro::poly_collection<InvocationTestFacade> GenerateSmallObjectInvocationPolyCollectionTestData();
+pro::poly_collection<InvocationTestFacade> GenerateLargeObjectInvocationPolyCollectionTestData();
+pro::poly_collection<BulkInvocationTestFacade> GenerateSmallObjectBulkInvocationPolyCollectionTestData();
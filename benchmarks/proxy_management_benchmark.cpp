@@ -45,6 +45,32 @@ struct DefaultFacade : pro::facade_builder
     ::support_copy<pro::constraint_level::nontrivial>
     ::build {};
 
+// Large enough to store each of the large objects inplace
+struct InlineStorageFacade : pro::facade_builder
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::expand_layout<sizeof(LargeObject3)>
+    ::build {};
+static_assert(pro::inplace_proxiable_target<LargeObject1, InlineStorageFacade>);
+static_assert(pro::inplace_proxiable_target<LargeObject2, InlineStorageFacade>);
+static_assert(pro::inplace_proxiable_target<LargeObject3, InlineStorageFacade>);
+
+// One pointer per proxy, with the meta referenced from the allocation
+struct EmbeddedMetaFacade : pro::facade_builder
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::support_embedded_meta
+    ::build {};
+
+struct MovableFacade : pro::facade_builder::build {};
+
+struct TriviallyRelocatableFacade : pro::facade_builder
+    ::support_relocation<pro::constraint_level::trivial>
+    ::build {};
+
+struct WeakReferenceableFacade : pro::facade_builder
+    ::support_copy<pro::constraint_level::nothrow>
+    ::support_weak
+    ::build {};
+
 void BM_SmallObjectManagementWithProxy(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<pro::proxy<DefaultFacade>> data;
@@ -58,6 +84,23 @@ void BM_SmallObjectManagementWithProxy(benchmark::State& state) {
   }
 }
 
+void BM_SmallObjectManagementWithProxy_Arena(benchmark::State& state) {
+  pro::arena arena;
+  for (auto _ : state) {
+    {
+      std::vector<pro::proxy<DefaultFacade>> data;
+      data.reserve(TestManagedObjectCount);
+      for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+        data.push_back(pro::make_proxy_in<DefaultFacade, SmallObject1>(arena));
+        data.push_back(pro::make_proxy_in<DefaultFacade, SmallObject2>(arena));
+        data.push_back(pro::make_proxy_in<DefaultFacade, SmallObject3>(arena));
+      }
+      benchmark::DoNotOptimize(data);
+    }
+    arena.reset();
+  }
+}
+
 void BM_SmallObjectManagementWithUniquePtr(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<std::unique_ptr<PolymorphicObjectBase>> data;
@@ -99,6 +142,34 @@ void BM_SmallObjectManagementWithSharedPtr_Pooled(benchmark::State& state) {
   }
 }
 
+void BM_SmallObjectManagementWithSharedProxy(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject1>());
+      data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject2>());
+      data.push_back(pro::make_proxy_shared<DefaultFacade, SmallObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_SmallObjectManagementWithSharedProxy_Pooled(benchmark::State& state) {
+  static std::pmr::unsynchronized_pool_resource pool;
+  std::pmr::polymorphic_allocator<> alloc{&pool};
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::allocate_proxy_shared<DefaultFacade, SmallObject1>(alloc));
+      data.push_back(pro::allocate_proxy_shared<DefaultFacade, SmallObject2>(alloc));
+      data.push_back(pro::allocate_proxy_shared<DefaultFacade, SmallObject3>(alloc));
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
 void BM_SmallObjectManagementWithAny(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<std::any> data;
@@ -125,6 +196,32 @@ void BM_LargeObjectManagementWithProxy(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectManagementWithProxy_EmbeddedMeta(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<EmbeddedMetaFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy<EmbeddedMetaFacade, LargeObject1>());
+      data.push_back(pro::make_proxy<EmbeddedMetaFacade, LargeObject2>());
+      data.push_back(pro::make_proxy<EmbeddedMetaFacade, LargeObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_LargeObjectManagementWithProxy_InlineStorage(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<InlineStorageFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy<InlineStorageFacade, LargeObject1>());
+      data.push_back(pro::make_proxy<InlineStorageFacade, LargeObject2>());
+      data.push_back(pro::make_proxy<InlineStorageFacade, LargeObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
 void BM_LargeObjectManagementWithProxy_Pooled(benchmark::State& state) {
   static std::pmr::unsynchronized_pool_resource pool;
   std::pmr::polymorphic_allocator<> alloc{&pool};
@@ -140,6 +237,23 @@ void BM_LargeObjectManagementWithProxy_Pooled(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectManagementWithProxy_Arena(benchmark::State& state) {
+  pro::arena arena;
+  for (auto _ : state) {
+    {
+      std::vector<pro::proxy<DefaultFacade>> data;
+      data.reserve(TestManagedObjectCount);
+      for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+        data.push_back(pro::make_proxy_in<DefaultFacade, LargeObject1>(arena));
+        data.push_back(pro::make_proxy_in<DefaultFacade, LargeObject2>(arena));
+        data.push_back(pro::make_proxy_in<DefaultFacade, LargeObject3>(arena));
+      }
+      benchmark::DoNotOptimize(data);
+    }
+    arena.reset();
+  }
+}
+
 void BM_LargeObjectManagementWithUniquePtr(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<std::unique_ptr<PolymorphicObjectBase>> data;
@@ -181,6 +295,34 @@ void BM_LargeObjectManagementWithSharedPtr_Pooled(benchmark::State& state) {
   }
 }
 
+void BM_LargeObjectManagementWithSharedProxy(benchmark::State& state) {
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::make_proxy_shared<DefaultFacade, LargeObject1>());
+      data.push_back(pro::make_proxy_shared<DefaultFacade, LargeObject2>());
+      data.push_back(pro::make_proxy_shared<DefaultFacade, LargeObject3>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_LargeObjectManagementWithSharedProxy_Pooled(benchmark::State& state) {
+  static std::pmr::unsynchronized_pool_resource pool;
+  std::pmr::polymorphic_allocator<> alloc{&pool};
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; i += TypeSeriesCount) {
+      data.push_back(pro::allocate_proxy_shared<DefaultFacade, LargeObject1>(alloc));
+      data.push_back(pro::allocate_proxy_shared<DefaultFacade, LargeObject2>(alloc));
+      data.push_back(pro::allocate_proxy_shared<DefaultFacade, LargeObject3>(alloc));
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
 void BM_LargeObjectManagementWithAny(benchmark::State& state) {
   for (auto _ : state) {
     std::vector<std::any> data;
@@ -194,16 +336,220 @@ void BM_LargeObjectManagementWithAny(benchmark::State& state) {
   }
 }
 
+template <class F>
+void LargeObjectRelocationWithProxyImpl(benchmark::State& state) {
+  std::vector<pro::proxy<F>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; ++i) {
+    data.push_back(pro::make_proxy<F, LargeObject1>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<F>> relocated;
+    relocated.reserve(TestManagedObjectCount);
+    for (auto& p : data) {
+      relocated.push_back(std::move(p));
+    }
+    data.swap(relocated);
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_LargeObjectRelocationWithProxy(benchmark::State& state)
+    { LargeObjectRelocationWithProxyImpl<MovableFacade>(state); }
+
+void BM_LargeObjectRelocationWithProxy_TriviallyRelocatable(
+    benchmark::State& state)
+    { LargeObjectRelocationWithProxyImpl<TriviallyRelocatableFacade>(state); }
+
+void BM_LargeObjectRelocationWithProxy_EmbeddedMeta(benchmark::State& state)
+    { LargeObjectRelocationWithProxyImpl<EmbeddedMetaFacade>(state); }
+
+template <class MakeProxy>
+void LargeObjectCopyWithProxyImpl(benchmark::State& state, MakeProxy make_proxy) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; ++i) {
+    data.push_back(make_proxy());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copied = data;
+    benchmark::DoNotOptimize(copied);
+  }
+}
+
+void BM_LargeObjectCopyWithProxy(benchmark::State& state) {
+  LargeObjectCopyWithProxyImpl(state,
+      [] { return pro::make_proxy<DefaultFacade, LargeObject2>(); });
+}
+
+void BM_LargeObjectCopyWithProxy_CopyOnWrite(benchmark::State& state) {
+  LargeObjectCopyWithProxyImpl(state,
+      [] { return pro::make_proxy_cow<DefaultFacade, LargeObject2>(); });
+}
+
+// Each of the objects is trivially copyable and stored inplace
+void BM_SmallObjectCopyWithProxy(benchmark::State& state) {
+  std::vector<pro::proxy<DefaultFacade>> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; i += 2) {
+    data.push_back(pro::make_proxy<DefaultFacade, SmallObject1>());
+    data.push_back(pro::make_proxy<DefaultFacade, double>());
+  }
+  for (auto _ : state) {
+    std::vector<pro::proxy<DefaultFacade>> copied = data;
+    benchmark::DoNotOptimize(copied);
+  }
+}
+
+void BM_SmallObjectCopyWithAny(benchmark::State& state) {
+  std::vector<std::any> data;
+  data.reserve(TestManagedObjectCount);
+  for (int i = 0; i < TestManagedObjectCount; i += 2) {
+    data.emplace_back(SmallObject1{});
+    data.emplace_back(double{});
+  }
+  for (auto _ : state) {
+    std::vector<std::any> copied = data;
+    benchmark::DoNotOptimize(copied);
+  }
+}
+
+constexpr int TestErasedObjectCount = 4000;
+
+template <class C>
+void ProxyPushBackImpl(benchmark::State& state) {
+  using F = TriviallyRelocatableFacade;
+  for (auto _ : state) {
+    C data;
+    for (int i = 0; i < TestManagedObjectCount; ++i) {
+      data.push_back(pro::make_proxy<F, SmallObject1>());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+template <class F, class C>
+void ProxyEraseImpl(benchmark::State& state) {
+  for (auto _ : state) {
+    state.PauseTiming();
+    C data;
+    data.reserve(TestErasedObjectCount);
+    for (int i = 0; i < TestErasedObjectCount; ++i) {
+      data.push_back(pro::make_proxy<F, SmallObject1>());
+    }
+    state.ResumeTiming();
+    while (!data.empty()) {
+      data.erase(data.begin());
+    }
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+// Mostly trivially destructible objects, as in a cache of small values
+template <class C>
+void ProxyClearImpl(benchmark::State& state) {
+  using F = MovableFacade;
+  for (auto _ : state) {
+    state.PauseTiming();
+    C data;
+    data.reserve(TestManagedObjectCount);
+    for (int i = 0; i < TestManagedObjectCount; ++i) {
+      if (i % 8 == 7) {
+        data.push_back(pro::make_proxy<F, SmallObject2>());
+      } else {
+        data.push_back(pro::make_proxy<F, SmallObject1>());
+      }
+    }
+    state.ResumeTiming();
+    data.clear();
+    benchmark::DoNotOptimize(data);
+  }
+}
+
+void BM_ProxyPushBackWithStdVector(benchmark::State& state)
+    { ProxyPushBackImpl<std::vector<pro::proxy<TriviallyRelocatableFacade>>>(state); }
+
+void BM_ProxyPushBackWithProxyVector(benchmark::State& state)
+    { ProxyPushBackImpl<pro::proxy_vector<TriviallyRelocatableFacade>>(state); }
+
+void BM_ProxyEraseWithStdVector(benchmark::State& state) {
+  using F = TriviallyRelocatableFacade;
+  ProxyEraseImpl<F, std::vector<pro::proxy<F>>>(state);
+}
+
+void BM_ProxyEraseWithProxyVector(benchmark::State& state) {
+  using F = TriviallyRelocatableFacade;
+  ProxyEraseImpl<F, pro::proxy_vector<F>>(state);
+}
+
+// The facade is not trivially relocatable, but the objects stored inplace are
+void BM_ProxyEraseWithStdVector_Movable(benchmark::State& state)
+    { ProxyEraseImpl<MovableFacade, std::vector<pro::proxy<MovableFacade>>>(state); }
+
+void BM_ProxyEraseWithProxyVector_Movable(benchmark::State& state)
+    { ProxyEraseImpl<MovableFacade, pro::proxy_vector<MovableFacade>>(state); }
+
+void BM_ProxyClearWithStdVector(benchmark::State& state)
+    { ProxyClearImpl<std::vector<pro::proxy<MovableFacade>>>(state); }
+
+void BM_ProxyClearWithProxyVector(benchmark::State& state)
+    { ProxyClearImpl<pro::proxy_vector<MovableFacade>>(state); }
+
+void BM_SharedObjectLockingWithWeakProxy(benchmark::State& state) {
+  static const pro::proxy<WeakReferenceableFacade> owner =
+      pro::make_proxy_shared<WeakReferenceableFacade, SmallObject1>();
+  static const pro::weak_proxy<WeakReferenceableFacade> observer = owner;
+  for (auto _ : state) {
+    auto locked = observer.lock();
+    benchmark::DoNotOptimize(locked);
+  }
+}
+
+void BM_SharedObjectLockingWithWeakPtr(benchmark::State& state) {
+  static const std::shared_ptr<PolymorphicObjectBase> owner =
+      std::make_shared<PolymorphicObject<SmallObject1>>();
+  static const std::weak_ptr<PolymorphicObjectBase> observer = owner;
+  for (auto _ : state) {
+    auto locked = observer.lock();
+    benchmark::DoNotOptimize(locked);
+  }
+}
+
 BENCHMARK(BM_SmallObjectManagementWithProxy);
+BENCHMARK(BM_SmallObjectManagementWithProxy_Arena);
 BENCHMARK(BM_SmallObjectManagementWithUniquePtr);
 BENCHMARK(BM_SmallObjectManagementWithSharedPtr);
 BENCHMARK(BM_SmallObjectManagementWithSharedPtr_Pooled);
+BENCHMARK(BM_SmallObjectManagementWithSharedProxy);
+BENCHMARK(BM_SmallObjectManagementWithSharedProxy_Pooled);
 BENCHMARK(BM_SmallObjectManagementWithAny);
 BENCHMARK(BM_LargeObjectManagementWithProxy);
+BENCHMARK(BM_LargeObjectManagementWithProxy_EmbeddedMeta);
+BENCHMARK(BM_LargeObjectManagementWithProxy_InlineStorage);
 BENCHMARK(BM_LargeObjectManagementWithProxy_Pooled);
+BENCHMARK(BM_LargeObjectManagementWithProxy_Arena);
 BENCHMARK(BM_LargeObjectManagementWithUniquePtr);
 BENCHMARK(BM_LargeObjectManagementWithSharedPtr);
 BENCHMARK(BM_LargeObjectManagementWithSharedPtr_Pooled);
+BENCHMARK(BM_LargeObjectManagementWithSharedProxy);
+BENCHMARK(BM_LargeObjectManagementWithSharedProxy_Pooled);
 BENCHMARK(BM_LargeObjectManagementWithAny);
+BENCHMARK(BM_LargeObjectRelocationWithProxy);
+BENCHMARK(BM_LargeObjectRelocationWithProxy_TriviallyRelocatable);
+BENCHMARK(BM_LargeObjectRelocationWithProxy_EmbeddedMeta);
+BENCHMARK(BM_LargeObjectCopyWithProxy);
+BENCHMARK(BM_LargeObjectCopyWithProxy_CopyOnWrite);
+BENCHMARK(BM_SmallObjectCopyWithProxy);
+BENCHMARK(BM_SmallObjectCopyWithAny);
+BENCHMARK(BM_ProxyPushBackWithStdVector);
+BENCHMARK(BM_ProxyPushBackWithProxyVector);
+BENCHMARK(BM_ProxyEraseWithStdVector);
+BENCHMARK(BM_ProxyEraseWithProxyVector);
+BENCHMARK(BM_ProxyEraseWithStdVector_Movable);
+BENCHMARK(BM_ProxyEraseWithProxyVector_Movable);
+BENCHMARK(BM_ProxyClearWithStdVector);
+BENCHMARK(BM_ProxyClearWithProxyVector);
+BENCHMARK(BM_SharedObjectLockingWithWeakProxy)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_SharedObjectLockingWithWeakPtr)->ThreadRange(1, 8)->UseRealTime();
 
 }  // namespace
@@ -6,14 +6,35 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <bit>
+#include <compare>
 #include <concepts>
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <ranges>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#if __STDC_HOSTED__
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <new>
+#include <span>
+#include <typeinfo>
+#include <vector>
+#if defined(PRO_ENABLE_PARALLEL)
+#include <thread>
+#endif  // defined(PRO_ENABLE_PARALLEL)
+#endif  // __STDC_HOSTED__
+#if defined(_MSC_VER) && !defined(__clang__) && \
+    (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>
+#endif  // defined(_MSC_VER) && !defined(__clang__) && ...
 
 #if __has_cpp_attribute(msvc::no_unique_address)
 #define ___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE msvc::no_unique_address
@@ -45,6 +66,14 @@ struct proxiable_ptr_constraints {
 
 template <class F> class proxy;
 
+template <class T>
+struct is_trivially_relocatable
+    : std::bool_constant<std::is_trivially_move_constructible_v<T> &&
+          std::is_trivially_destructible_v<T>> {};
+template <class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
 namespace details {
 
 struct applicable_traits { static constexpr bool applicable = true; };
@@ -126,9 +155,7 @@ consteval bool has_relocatability(constraint_level level) {
     case constraint_level::nothrow:
       return std::is_nothrow_move_constructible_v<T> &&
           std::is_nothrow_destructible_v<T>;
-    case constraint_level::trivial:
-      return std::is_trivially_move_constructible_v<T> &&
-          std::is_trivially_destructible_v<T>;
+    case constraint_level::trivial: return is_trivially_relocatable_v<T>;
     default: return false;
   }
 }
@@ -155,6 +182,8 @@ class destruction_guard {
   T* p_;
 };
 
+template <class T> class inplace_ptr;
+
 template <class P, qualifier_type Q, bool NE>
 struct ptr_traits : inapplicable_traits {};
 template <class P, qualifier_type Q, bool NE>
@@ -225,6 +254,16 @@ void copying_default_dispatcher(std::byte& self, const std::byte& rhs)
   std::uninitialized_copy_n(
       std::assume_aligned<Align>(&rhs), Len, std::assume_aligned<Align>(&self));
 }
+// Compiles to a few moves for small Len where the loop above may not, which is
+// why proxy calls it instead of the dispatchers for trivial lifetime operations
+template <std::size_t Len>
+void copy_ptr_bytes(std::byte* dst, const std::byte* src) noexcept {
+#if __STDC_HOSTED__
+  std::memcpy(dst, src, Len);
+#else
+  std::uninitialized_copy_n(src, Len, dst);
+#endif  // __STDC_HOSTED__
+}
 template <class P>
 void relocation_dispatcher(std::byte& self, const std::byte& rhs)
     noexcept(has_relocatability<P>(constraint_level::nothrow)) {
@@ -237,6 +276,56 @@ void destruction_dispatcher(std::byte& self)
     noexcept(has_destructibility<P>(constraint_level::nothrow))
     { std::destroy_at(std::launder(reinterpret_cast<P*>(&self))); }
 inline void destruction_default_dispatcher(std::byte&) noexcept {}
+#if __STDC_HOSTED__
+template <class P, qualifier_type Q>
+struct bulk_span_traits : inapplicable_traits {};
+template <class T, qualifier_type Q>
+struct bulk_span_traits<inplace_ptr<T>, Q> : applicable_traits
+    { using type = std::span<std::remove_reference_t<add_qualifier_t<T, Q>>>; };
+template <class R>
+using bulk_results_t =
+    std::conditional_t<std::is_void_v<R>, std::nullptr_t, R*>;
+template <class D, class P, qualifier_type Q, bool NE, class R, class... Args>
+concept bulk_invocable_ptr = bulk_span_traits<P, Q>::applicable &&
+    ((std::is_void_v<R> && invocable_dispatch<D, NE, void,
+        typename bulk_span_traits<P, Q>::type, Args&...>) ||
+    (!std::is_void_v<R> && invocable_dispatch<D, NE, void,
+        typename bulk_span_traits<P, Q>::type, std::span<R>, Args&...>));
+// Invokes n contiguous pointers at once, either with the bulk implementation
+// on a span of the objects when P is inplace_ptr<T>, or one pointer at a time
+template <class D, class P, qualifier_type Q, bool NE, class R, class... Args>
+void bulk_conv_dispatcher(add_qualifier_ptr_t<std::byte, Q> first,
+    std::size_t n, bulk_results_t<R> results, Args... args) noexcept(NE) {
+  if constexpr (bulk_invocable_ptr<D, P, Q, NE, R, Args...>) {
+    using S = typename bulk_span_traits<P, Q>::type;
+    S objects{std::launder(reinterpret_cast<typename S::pointer>(first)), n};
+    if constexpr (std::is_void_v<R>) {
+      D{}(objects, args...);
+    } else {
+      D{}(objects, std::span<R>{results, n}, args...);
+    }
+  } else {
+    auto ptrs = std::launder(reinterpret_cast<add_qualifier_ptr_t<P, Q>>(first));
+    for (std::size_t i = 0u; i < n; ++i) {
+      if constexpr (std::is_void_v<R>) {
+        if constexpr (invocable_dispatch_ptr_indirect<
+            D, P, Q, NE, R, Args&...>) {
+          invoke_dispatch<D, R>(*ptrs[i], args...);
+        } else {
+          invoke_dispatch<D, R>(nullptr, args...);
+        }
+      } else {
+        if constexpr (invocable_dispatch_ptr_indirect<
+            D, P, Q, NE, R, Args&...>) {
+          results[i] = invoke_dispatch<D, R>(*ptrs[i], args...);
+        } else {
+          results[i] = invoke_dispatch<D, R>(nullptr, args...);
+        }
+      }
+    }
+  }
+}
+#endif  // __STDC_HOSTED__
 
 template <class O> struct overload_traits : inapplicable_traits {};
 template <qualifier_type Q, bool NE, class R, class... Args>
@@ -261,10 +350,28 @@ struct overload_traits_impl : applicable_traits {
     }
   };
 
+#if __STDC_HOSTED__
+  template <class D>
+  struct bulk_meta_provider {
+    template <class P>
+    static constexpr auto get() -> func_ptr_t<NE, void,
+        add_qualifier_ptr_t<std::byte, Q>, std::size_t, bulk_results_t<R>,
+        Args...> { return &bulk_conv_dispatcher<D, P, Q, NE, R, Args...>; }
+  };
+#endif  // __STDC_HOSTED__
+
   template <bool IS_DIRECT, class D, class P>
   static constexpr bool applicable_ptr =
       meta_provider<IS_DIRECT, D>::template get<P>() != nullptr;
+  using return_type = R;
   static constexpr qualifier_type qualifier = Q;
+  static constexpr bool bulk_applicable = (Q == qualifier_type::lv ||
+      Q == qualifier_type::const_lv) && (!std::is_rvalue_reference_v<Args> &&
+          ...);
+  template <class... Us>
+  static constexpr bool const_lv_invocable =
+      std::is_invocable_v<void (*)(Args...),
+          const std::remove_reference_t<Us>&...>;
 };
 template <class R, class... Args>
 struct overload_traits<R(Args...)>
@@ -313,6 +420,15 @@ struct dispatcher_meta {
   decltype(MP::template get<void>()) dispatcher;
 };
 
+// Marks a meta that leads with the dispatchers of hot conventions. The meta is
+// then aligned to a cache line
+struct hot_meta_tag {
+  constexpr hot_meta_tag() noexcept = default;
+  template <class P>
+  constexpr explicit hot_meta_tag(std::in_place_type_t<P>) noexcept {}
+};
+constexpr std::size_t hot_meta_align = 64u;
+
 template <class... Ms>
 struct composite_meta_impl : Ms... {
   constexpr composite_meta_impl() noexcept = default;
@@ -343,13 +459,46 @@ consteval bool is_conv_is_direct_well_formed() {
   return false;
 }
 
+template <class C>
+consteval bool is_conv_hot() {
+  if constexpr (requires { { C::is_hot } -> std::same_as<const bool&>; }) {
+    return C::is_hot;
+  } else {
+    return false;
+  }
+}
+
+template <class D> struct bulk_dispatch_traits : inapplicable_traits {};
+#if __STDC_HOSTED__
+// Marks a convention whose dispatchers are also available in bulk
+template <class D>
+struct bulk_dispatch : D {};
+template <class D>
+struct bulk_dispatch_traits<bulk_dispatch<D>> : applicable_traits {};
+#endif  // __STDC_HOSTED__
+template <class C, class O>
+struct bulk_meta_traits : std::type_identity<void> {};
+#if __STDC_HOSTED__
+template <class C, class O>
+    requires(!C::is_direct &&
+        bulk_dispatch_traits<typename C::dispatch_type>::applicable)
+struct bulk_meta_traits<C, O> : std::type_identity<dispatcher_meta<
+    typename overload_traits<O>::template bulk_meta_provider<
+        typename C::dispatch_type>>> {};
+#endif  // __STDC_HOSTED__
+
+template <class C, class O>
+concept bulk_conv = !std::is_void_v<typename bulk_meta_traits<C, O>::type>;
+
 template <class C, class... Os>
 struct conv_traits_impl : inapplicable_traits {};
 template <class C, class... Os>
     requires(sizeof...(Os) > 0u && (overload_traits<Os>::applicable && ...))
 struct conv_traits_impl<C, Os...> : applicable_traits {
-  using meta = composite_meta_impl<dispatcher_meta<typename overload_traits<Os>
-      ::template meta_provider<C::is_direct, typename C::dispatch_type>>...>;
+  using meta = composite_meta<composite_meta_impl<dispatcher_meta<
+      typename overload_traits<Os>::template meta_provider<
+          C::is_direct, typename C::dispatch_type>>...>,
+      typename bulk_meta_traits<C, Os>::type...>;
 
   template <class P>
   static constexpr bool applicable_ptr =
@@ -369,27 +518,33 @@ template <class C>
 struct conv_traits<C>
     : instantiated_t<conv_traits_impl, typename C::overload_types, C> {};
 
-template <bool NE>
-struct copyability_meta_provider {
-  template <class P>
-  static constexpr func_ptr_t<NE, void, std::byte&, const std::byte&> get() {
-    if constexpr (has_copyability<P>(constraint_level::trivial)) {
-      return &copying_default_dispatcher<sizeof(P), alignof(P)>;
-    } else {
-      return &copying_dispatcher<P>;
+// Trivially copyable or relocatable pointer types share the dispatcher that
+// copies the whole storage of a proxy, so that a proxy recognizes them by
+// comparing the dispatcher instead of calling it
+template <std::size_t Len, std::size_t Align>
+struct storage_meta_providers {
+  template <bool NE>
+  struct copyability {
+    template <class P>
+    static constexpr func_ptr_t<NE, void, std::byte&, const std::byte&> get() {
+      if constexpr (has_copyability<P>(constraint_level::trivial)) {
+        return &copying_default_dispatcher<Len, Align>;
+      } else {
+        return &copying_dispatcher<P>;
+      }
     }
-  }
-};
-template <bool NE>
-struct relocatability_meta_provider {
-  template <class P>
-  static constexpr func_ptr_t<NE, void, std::byte&, const std::byte&> get() {
-    if constexpr (has_relocatability<P>(constraint_level::trivial)) {
-      return &copying_default_dispatcher<sizeof(P), alignof(P)>;
-    } else {
-      return &relocation_dispatcher<P>;
+  };
+  template <bool NE>
+  struct relocatability {
+    template <class P>
+    static constexpr func_ptr_t<NE, void, std::byte&, const std::byte&> get() {
+      if constexpr (has_relocatability<P>(constraint_level::trivial)) {
+        return &copying_default_dispatcher<Len, Align>;
+      } else {
+        return &relocation_dispatcher<P>;
+      }
     }
-  }
+  };
 };
 template <bool NE>
 struct destructibility_meta_provider {
@@ -413,6 +568,41 @@ struct lifetime_meta_traits<MP, constraint_level::nontrivial>
 template <template <bool> class MP, constraint_level C>
 using lifetime_meta_t = typename lifetime_meta_traits<MP, C>::type;
 
+#if defined(__GNUC__) || defined(__clang__)
+#define ___PRO_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#elif defined(_M_IX86) || defined(_M_X64)
+#define ___PRO_PREFETCH(ADDR) \
+    _mm_prefetch(static_cast<const char*>(ADDR), _MM_HINT_T0)
+#else
+#define ___PRO_PREFETCH(ADDR) static_cast<void>(ADDR)
+#endif  // defined(__GNUC__) || defined(__clang__)
+
+// Only prefetches the element when the pointer can be dereferenced without
+// side effects. Otherwise, the storage may not even lead with an address (e.g.,
+// an inplace object, or a pointer with a stateful allocator)
+template <class P>
+void element_prefetcher(const std::byte& self) noexcept {
+  if constexpr (requires(const P& ptr) { { *ptr } noexcept; } &&
+      std::is_lvalue_reference_v<decltype(*std::declval<const P&>())> &&
+      std::is_object_v<std::remove_reference_t<
+          decltype(*std::declval<const P&>())>>) {
+    const P& ptr = *std::launder(reinterpret_cast<const P*>(&self));
+    ___PRO_PREFETCH(const_cast<const void*>(
+        static_cast<const volatile void*>(std::addressof(*ptr))));
+  }
+}
+// Part of the meta referenced by pointer or by index, so that inline metas do
+// not grow. Being part of the meta of the facade rather than of the table that
+// stores it, the hook is also found through the meta of a base facade
+struct prefetch_meta {
+  constexpr prefetch_meta() noexcept : prefetcher(nullptr) {}
+  template <class P>
+  constexpr explicit prefetch_meta(std::in_place_type_t<P>) noexcept
+      : prefetcher(&element_prefetcher<P>) {}
+
+  void (*prefetcher)(const std::byte&) noexcept;
+};
+
 template <class... As>
 class ___PRO_ENFORCE_EBO composite_accessor_impl : public As... {
   template <class> friend class pro::proxy;
@@ -468,7 +658,10 @@ template <class F, class... Cs>
 struct facade_conv_traits_impl : inapplicable_traits {};
 template <class F, class... Cs> requires(conv_traits<Cs>::applicable && ...)
 struct facade_conv_traits_impl<F, Cs...> : applicable_traits {
-  using conv_meta = composite_meta<typename conv_traits<Cs>::meta...>;
+  using hot_conv_meta = composite_meta<std::conditional_t<
+      is_conv_hot<Cs>(), typename conv_traits<Cs>::meta, void>...>;
+  using cold_conv_meta = composite_meta<std::conditional_t<
+      is_conv_hot<Cs>(), void, typename conv_traits<Cs>::meta>...>;
   using indirect_accessor = composite_accessor<false, F, Cs...>;
   using direct_accessor = composite_accessor<true, F, Cs...>;
   using base = std::conditional_t<std::is_same_v<direct_accessor,
@@ -486,6 +679,51 @@ struct facade_refl_traits_impl {
   static constexpr bool refl_applicable_ptr =
       (is_reflection_type_well_formed<Rs, P>() && ...);
 };
+template <class... Ts>
+struct closed_traits_impl : applicable_traits {
+  using ptr_types = std::tuple<inplace_ptr<Ts>...>;
+
+  template <class P>
+  static constexpr bool applicable_ptr =
+      (std::is_same_v<P, inplace_ptr<Ts>> || ...);
+};
+template <class F>
+struct closed_traits : inapplicable_traits
+    { template <class P> static constexpr bool applicable_ptr = true; };
+template <class F>
+    requires(
+        requires { typename F::restricted_types; } &&
+        !std::is_void_v<typename F::restricted_types>)
+struct closed_traits<F>
+    : instantiated_t<closed_traits_impl, typename F::restricted_types> {};
+using ptr_prototype = void*[2];
+template <std::size_t N> struct inline_meta_layout {};
+struct indexed_meta_layout {};
+struct embedded_meta_layout {};
+template <class MP> struct is_direct_meta_ptr;
+template <class M, std::size_t N> struct meta_ptr_traits;
+template <class L, class M>
+struct prefetch_meta_traits : std::type_identity<void> {};
+template <std::size_t N, class M>
+struct prefetch_meta_traits<inline_meta_layout<N>, M>
+    : std::conditional<is_direct_meta_ptr<
+          typename meta_ptr_traits<M, N>::type>::value, void, prefetch_meta> {};
+template <class M>
+struct prefetch_meta_traits<void, M>
+    : prefetch_meta_traits<inline_meta_layout<std::extent_v<ptr_prototype>>,
+          M> {};
+template <class M>
+struct prefetch_meta_traits<indexed_meta_layout, M>
+    : std::type_identity<prefetch_meta> {};
+template <class F>
+struct facade_meta_layout : std::type_identity<void> {};
+template <class F> requires(requires { typename F::meta_layout; })
+struct facade_meta_layout<F>
+    : std::type_identity<typename F::meta_layout> {};
+// Lays out the meta of a facade that extends a base facade with the meta of
+// the base as its leading subobject, see the specialization below
+template <class F>
+struct facade_base_traits { template <class H, class M> using meta = M; };
 template <class F> struct facade_traits : inapplicable_traits {};
 template <class F>
     requires(
@@ -497,64 +735,384 @@ template <class F>
         is_tuple_like_well_formed<typename F::convention_types>() &&
         instantiated_t<facade_conv_traits_impl, typename F::convention_types, F>
             ::applicable &&
-        is_tuple_like_well_formed<typename F::reflection_types>())
+        is_tuple_like_well_formed<typename F::reflection_types>() &&
+        (!requires { typename F::restricted_types; } ||
+            std::is_void_v<typename F::restricted_types> ||
+            is_tuple_like_well_formed<typename F::restricted_types>()))
 struct facade_traits<F>
     : instantiated_t<facade_conv_traits_impl, typename F::convention_types, F>,
       instantiated_t<facade_refl_traits_impl, typename F::reflection_types, F> {
+  using storage_providers = storage_meta_providers<
+      F::constraints.max_size, F::constraints.max_align>;
   using copyability_meta = lifetime_meta_t<
-      copyability_meta_provider, F::constraints.copyability>;
+      storage_providers::template copyability, F::constraints.copyability>;
   using relocatability_meta = lifetime_meta_t<
-      relocatability_meta_provider,
+      storage_providers::template relocatability,
       F::constraints.copyability == constraint_level::trivial ?
           constraint_level::trivial : F::constraints.relocatability>;
   using destructibility_meta = lifetime_meta_t<
       destructibility_meta_provider, F::constraints.destructibility>;
-  using meta = composite_meta<copyability_meta, relocatability_meta,
-      destructibility_meta, typename facade_traits::conv_meta,
-      typename facade_traits::refl_meta>;
+  // Dispatchers of hot conventions go first, so that they share the leading
+  // cache line of the meta only with each other
+  template <class PM>
+  using meta_with = typename facade_base_traits<F>::template meta<
+      typename facade_traits::hot_conv_meta, composite_meta<
+      std::conditional_t<std::is_same_v<
+          typename facade_traits::hot_conv_meta, composite_meta_impl<>>,
+          void, hot_meta_tag>,
+      typename facade_traits::hot_conv_meta, copyability_meta,
+      relocatability_meta, destructibility_meta, PM,
+      typename facade_traits::cold_conv_meta,
+      typename facade_traits::refl_meta>>;
+  // The prefetch hook is only added when the meta without it is not stored in
+  // the proxy, and closed facades store the object inplace
+  using prefetch_meta = std::conditional_t<closed_traits<F>::applicable, void,
+      typename prefetch_meta_traits<typename facade_meta_layout<F>::type,
+          meta_with<void>>::type>;
+  using meta = meta_with<prefetch_meta>;
   static constexpr bool has_indirection = !std::is_same_v<
       typename facade_traits::indirect_accessor, composite_accessor_impl<>>;
+  static constexpr bool is_closed = closed_traits<F>::applicable;
+
+  template <class P>
+  static constexpr bool closed_applicable_ptr =
+      closed_traits<F>::template applicable_ptr<P>;
 };
 
-using ptr_prototype = void*[2];
+template <class M, class P>
+struct unique_meta : M {
+  constexpr explicit unique_meta(const void* self) noexcept
+      : M(std::in_place_type<P>), self(self) {}
+
+  // Identical data folding (e.g., MSVC /OPT:ICF) may merge the tables of
+  // different pointer types with equal dispatchers, so that the address of a
+  // table would no longer identify the pointer type in identity() and is<P>().
+  // Referring to itself makes each table distinct at the cost of one word per
+  // table (not per proxy)
+  const void* self;
+};
+template <class M, class P>
+alignas(std::is_base_of_v<hot_meta_tag, M> ? hot_meta_align :
+    alignof(unique_meta<M, P>))
+inline constexpr unique_meta<M, P> meta_storage{&meta_storage<M, P>};
 
 template <class M>
 struct meta_ptr_indirect_impl {
   constexpr meta_ptr_indirect_impl() noexcept : ptr_(nullptr) {};
   template <class P>
   constexpr explicit meta_ptr_indirect_impl(std::in_place_type_t<P>) noexcept
-      : ptr_(&storage<P>) {}
+      : ptr_(&meta_storage<M, P>) {}
+  constexpr explicit meta_ptr_indirect_impl(const M* ptr) noexcept
+      : ptr_(ptr) {}
   bool has_value() const noexcept { return ptr_ != nullptr; }
   void reset() noexcept { ptr_ = nullptr; }
+  const void* identity() const noexcept { return ptr_; }
+  template <class P>
+  bool is() const noexcept { return ptr_ == &meta_storage<M, P>; }
   const M* operator->() const noexcept { return ptr_; }
 
  private:
   const M* ptr_;
-  template <class P> static constexpr M storage{std::in_place_type<P>};
 };
 template <class M, class DM>
 struct meta_ptr_direct_impl : private M {
   using M::M;
   bool has_value() const noexcept { return this->DM::dispatcher != nullptr; }
   void reset() noexcept { this->DM::dispatcher = nullptr; }
+  // An inline meta has no address identifying the pointer type, and equal
+  // dispatchers do not imply equal types, so runs of proxies are not detected
+  const void* identity() const noexcept { return nullptr; }
   const M* operator->() const noexcept { return this; }
 };
+template <class MP>
+struct is_direct_meta_ptr : std::false_type {};
+template <class M, class DM>
+struct is_direct_meta_ptr<meta_ptr_direct_impl<M, DM>> : std::true_type {};
 template <class M>
 struct meta_ptr_traits_impl : std::type_identity<meta_ptr_indirect_impl<M>> {};
 template <class MP, class... Ms>
 struct meta_ptr_traits_impl<composite_meta_impl<dispatcher_meta<MP>, Ms...>>
     : std::type_identity<meta_ptr_direct_impl<composite_meta_impl<
           dispatcher_meta<MP>, Ms...>, dispatcher_meta<MP>>> {};
-template <class M>
+template <class MP, class... Ms>
+struct meta_ptr_traits_impl<
+    composite_meta_impl<hot_meta_tag, dispatcher_meta<MP>, Ms...>>
+    : std::type_identity<meta_ptr_direct_impl<composite_meta_impl<
+          hot_meta_tag, dispatcher_meta<MP>, Ms...>, dispatcher_meta<MP>>> {};
+template <class M, std::size_t N>
 struct meta_ptr_traits : std::type_identity<meta_ptr_indirect_impl<M>> {};
-template <class M>
-    requires(sizeof(M) <= sizeof(ptr_prototype) &&
+template <class M, std::size_t N>
+    requires(sizeof(M) <= sizeof(void*) * N &&
         alignof(M) <= alignof(ptr_prototype) &&
         std::is_nothrow_default_constructible_v<M> &&
         std::is_trivially_copyable_v<M>)
-struct meta_ptr_traits<M> : meta_ptr_traits_impl<M> {};
+struct meta_ptr_traits<M, N> : meta_ptr_traits_impl<M> {};
+template <class M, std::size_t N>
+using meta_ptr = typename meta_ptr_traits<M, N>::type;
+
+
+template <class P, class... Ps>
+consteval std::size_t index_of() {
+  std::size_t result = 0u;
+  ((std::is_same_v<P, Ps> ? false : (++result, true)) && ...);
+  return result;
+}
+template <class M, class... Ps>
+struct meta_ptr_index_impl {
+  using index_type = std::conditional_t<
+      (sizeof...(Ps) < std::numeric_limits<unsigned char>::max()),
+      unsigned char, std::size_t>;
+
+  constexpr meta_ptr_index_impl() noexcept : index_(0u) {}
+  template <class P>
+  constexpr explicit meta_ptr_index_impl(std::in_place_type_t<P>) noexcept
+      : index_(static_cast<index_type>(index_of<P, Ps...>() + 1u)) {}
+  bool has_value() const noexcept { return index_ != 0u; }
+  void reset() noexcept { index_ = 0u; }
+  std::size_t index() const noexcept { return index_ - 1u; }
+  template <class P>
+  bool is() const noexcept {
+    if constexpr ((std::is_same_v<P, Ps> || ...)) {
+      return index_ == index_of<P, Ps...>() + 1u;
+    } else {
+      return false;
+    }
+  }
+  const void* identity() const noexcept { return operator->(); }
+  const M* operator->() const noexcept { return table_[index_ - 1u]; }
+
+ private:
+  static constexpr const M* table_[] = {&meta_storage<M, Ps>...};
+
+  index_type index_;
+};
+#if __STDC_HOSTED__
+// Assigns a 32-bit index to the meta of each pointer type on first use. The
+// table grows geometrically under a spin lock, and a replaced table is never
+// freed because other threads may still be reading from it
+template <class M>
+class meta_registry {
+ public:
+  meta_registry() = delete;
+
+  static const M* const* table() noexcept
+      { return table_.load(std::memory_order_acquire); }
+  template <class P>
+  static std::uint32_t index() {
+    static const std::uint32_t result = add(&meta_storage<M, P>);
+    return result;
+  }
+
+ private:
+  struct lock_guard {
+    lock_guard() noexcept {
+      while (lock_.test_and_set(std::memory_order_acquire)) {}
+    }
+    ~lock_guard() { lock_.clear(std::memory_order_release); }
+  };
+
+  static std::uint32_t add(const M* meta) {
+    lock_guard guard;
+    const M** table = table_.load(std::memory_order_relaxed);
+    if (size_ == capacity_) {
+      assert(capacity_ <= std::numeric_limits<std::uint32_t>::max() / 2u);
+      const M** grown = new const M*[capacity_ * 2u];
+      std::uninitialized_copy_n(table, size_, grown);
+      table = grown;
+      capacity_ *= 2u;
+      table_.store(table, std::memory_order_release);
+    }
+    table[size_] = meta;
+    return size_++;
+  }
+
+  static constexpr std::uint32_t initial_capacity = 64u;
+
+  static inline const M* initial_table_[initial_capacity] = {nullptr};
+  static inline std::atomic<const M**> table_{initial_table_};
+  static inline std::uint32_t size_ = 1u;  // Index 0 denotes no value
+  static inline std::uint32_t capacity_ = initial_capacity;
+  static inline std::atomic_flag lock_;
+};
+template <class M>
+struct meta_ptr_registry_impl {
+  constexpr meta_ptr_registry_impl() noexcept : index_(0u) {}
+  template <class P>
+  explicit meta_ptr_registry_impl(std::in_place_type_t<P>)
+      : index_(meta_registry<M>::template index<P>()) {}
+  bool has_value() const noexcept { return index_ != 0u; }
+  void reset() noexcept { index_ = 0u; }
+  const void* identity() const noexcept { return operator->(); }
+  template <class P>
+  bool is() const noexcept
+      { return operator->() == &meta_storage<M, P>; }
+  const M* operator->() const noexcept
+      { return meta_registry<M>::table()[index_]; }
+
+ private:
+  std::uint32_t index_;
+};
+#endif  // __STDC_HOSTED__
+
+template <class F> struct proxy_helper;
+template <class M, class T, class Alloc> class embedded_ptr;
+// The header of a block allocated by an embedded pointer, which references the
+// meta of the pointer
 template <class M>
-using meta_ptr = typename meta_ptr_traits<M>::type;
+struct embedded_header { const M* meta; };
+// A proxy with an embedded meta holds nothing but an embedded pointer. The meta
+// pointer is then an empty member of the proxy, which reads the header of the
+// block through the storage. Copying or assigning it has no effect, since the
+// header comes with the contained pointer
+template <class F>
+struct meta_ptr_embedded_impl {
+  using meta_type = typename facade_traits<F>::meta;
+
+  meta_ptr_embedded_impl() noexcept { reset(); }
+  template <class P>
+  constexpr explicit meta_ptr_embedded_impl(std::in_place_type_t<P>) noexcept
+      {}
+  meta_ptr_embedded_impl(const meta_ptr_embedded_impl&) noexcept = default;
+  meta_ptr_embedded_impl& operator=(const meta_ptr_embedded_impl&) noexcept
+      = default;
+  bool has_value() const noexcept { return header() != nullptr; }
+  void reset() noexcept {
+    std::construct_at(reinterpret_cast<const embedded_header<meta_type>**>(
+        proxy_helper<F>::get_embedded_storage(*this)), nullptr);
+  }
+  const void* identity() const noexcept
+      { return has_value() ? header()->meta : nullptr; }
+  template <class P>
+  bool is() const noexcept
+      { return has_value() && header()->meta == &meta_storage<meta_type, P>; }
+  const meta_type* operator->() const noexcept { return header()->meta; }
+  const void* block() const noexcept { return header(); }
+
+ private:
+  const embedded_header<meta_type>* header() const noexcept {
+    return *std::launder(reinterpret_cast<
+        const embedded_header<meta_type>* const*>(
+            proxy_helper<F>::get_embedded_storage(*this)));
+  }
+};
+template <class P, class M>
+struct is_embedded_ptr : std::false_type {};
+template <class M, class T, class Alloc>
+struct is_embedded_ptr<embedded_ptr<M, T, Alloc>, M> : std::true_type {};
+
+template <class L> struct meta_layout_traits;
+template <>
+struct meta_layout_traits<void> {
+  template <class M>
+  using meta_ptr_type = meta_ptr<M, std::extent_v<ptr_prototype>>;
+};
+template <std::size_t N>
+struct meta_layout_traits<inline_meta_layout<N>> {
+  template <class M>
+  using meta_ptr_type = meta_ptr<M, N>;
+};
+#if __STDC_HOSTED__
+template <>
+struct meta_layout_traits<indexed_meta_layout> {
+  template <class M>
+  using meta_ptr_type = meta_ptr_registry_impl<M>;
+};
+#endif  // __STDC_HOSTED__
+template <>
+struct meta_layout_traits<embedded_meta_layout> {};
+template <class F>
+struct facade_meta_layout_traits : meta_layout_traits<void> {};
+template <class F> requires(requires { typename F::meta_layout; })
+struct facade_meta_layout_traits<F>
+    : meta_layout_traits<typename F::meta_layout> {};
+template <class F>
+concept embedded_meta_facade = facade_traits<F>::applicable &&
+    !facade_traits<F>::is_closed && std::is_base_of_v<
+        meta_layout_traits<embedded_meta_layout>, facade_meta_layout_traits<F>>;
+template <class F, class P>
+concept meta_applicable_ptr = !embedded_meta_facade<F> ||
+    is_embedded_ptr<P, typename facade_traits<F>::meta>::value;
+
+template <class F>
+struct facade_meta_ptr_traits : std::type_identity<typename
+    facade_meta_layout_traits<F>::template meta_ptr_type<
+        typename facade_traits<F>::meta>> {};
+template <class F> requires(facade_traits<F>::is_closed)
+struct facade_meta_ptr_traits<F> : std::type_identity<instantiated_t<
+    meta_ptr_index_impl, typename closed_traits<F>::ptr_types,
+    typename facade_traits<F>::meta>> {};
+template <class F> requires(embedded_meta_facade<F>)
+struct facade_meta_ptr_traits<F>
+    : std::type_identity<meta_ptr_embedded_impl<F>> {};
+template <class F>
+using facade_meta_ptr = typename facade_meta_ptr_traits<F>::type;
+
+template <class F>
+concept type_identifying_facade =
+    !is_direct_meta_ptr<facade_meta_ptr<F>>::value;
+template <class F>
+concept indirect_meta_facade = facade_traits<F>::applicable && std::is_same_v<
+    facade_meta_ptr<F>, meta_ptr_indirect_impl<typename facade_traits<F>::meta>>;
+template <class B, class O, class I>
+struct base_meta_reduction : std::type_identity<O> {};
+template <class B, class... Ms, class I> requires(!std::is_base_of_v<I, B>)
+struct base_meta_reduction<B, composite_meta_impl<Ms...>, I>
+    : std::type_identity<composite_meta_impl<Ms..., I>> {};
+template <class B>
+struct base_meta_helper {
+  template <class O, class I>
+  using reduction_t = typename base_meta_reduction<B, O, I>::type;
+};
+template <class B, class M> struct base_meta_traits;
+template <class B, class... Ms>
+struct base_meta_traits<B, composite_meta_impl<Ms...>>
+    : std::type_identity<recursive_reduction_t<
+          base_meta_helper<B>::template reduction_t, composite_meta_impl<B>,
+          Ms...>> {};
+template <class B, class M>
+using base_meta_t = typename base_meta_traits<B, M>::type;
+// The parts of the meta that the base already has are not repeated, so that
+// each dispatcher is still found unambiguously by its type. The base is only
+// laid out this way when the meta of both is referenced by pointer, when every
+// pointer type of the facade also meets the constraints of the base, and when
+// every hot convention of the facade is also hot in the base, since it would
+// otherwise not lead the meta
+template <class F>
+    requires(
+        requires { typename F::base_facade; } &&
+        std::is_base_of_v<meta_layout_traits<void>,
+            facade_meta_layout_traits<F>> &&
+        !closed_traits<F>::applicable &&
+        indirect_meta_facade<typename F::base_facade> &&
+        F::constraints.max_size <= F::base_facade::constraints.max_size &&
+        F::constraints.max_align <= F::base_facade::constraints.max_align &&
+        F::constraints.copyability >=
+            F::base_facade::constraints.copyability &&
+        F::constraints.relocatability >=
+            F::base_facade::constraints.relocatability &&
+        F::constraints.destructibility >=
+            F::base_facade::constraints.destructibility)
+struct facade_base_traits<F> {
+  using base_meta = typename facade_traits<typename F::base_facade>::meta;
+  using base_hot_meta =
+      typename facade_traits<typename F::base_facade>::hot_conv_meta;
+
+  template <class H, class M>
+  using meta = std::conditional_t<std::is_same_v<base_meta_t<base_hot_meta, H>,
+      composite_meta_impl<base_hot_meta>>, base_meta_t<base_meta, M>, M>;
+};
+// A proxy of F is converted to a proxy of B by copying or relocating the
+// pointer into the storage of the same layout, and by referring to the meta of
+// B that the meta of F leads with
+template <class F, class B>
+concept upcastable_facade = facade_traits<B>::applicable &&
+    F::constraints.max_size == B::constraints.max_size &&
+    F::constraints.max_align == B::constraints.max_align &&
+    indirect_meta_facade<F> && indirect_meta_facade<B> &&
+    !std::is_same_v<typename facade_traits<F>::meta,
+        typename facade_traits<B>::meta> &&
+    std::is_base_of_v<typename facade_traits<B>::meta,
+        typename facade_traits<F>::meta>;
 
 template <class MP>
 struct meta_ptr_reset_guard {
@@ -567,43 +1125,310 @@ struct meta_ptr_reset_guard {
   MP& meta_;
 };
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#define ___PRO_UNREACHABLE() __assume(0)
+#else
+#define ___PRO_UNREACHABLE() __builtin_unreachable()
+#endif  // defined(_MSC_VER) && !defined(__clang__)
+
+#define ___PRO_CLOSED_DISPATCH_CASE(I) \
+    case (I): \
+      if constexpr (B + (I) < N) { \
+        return closed_call<C, O, Q, B + (I)>( \
+            std::forward<add_qualifier_t<std::byte, Q>>(self), \
+            std::forward<Args>(args)...); \
+      } \
+      [[fallthrough]];
+#define ___PRO_CLOSED_DISPATCH_CASES_4(I) \
+    ___PRO_CLOSED_DISPATCH_CASE(I) \
+    ___PRO_CLOSED_DISPATCH_CASE((I) + 1u) \
+    ___PRO_CLOSED_DISPATCH_CASE((I) + 2u) \
+    ___PRO_CLOSED_DISPATCH_CASE((I) + 3u)
+#define ___PRO_CLOSED_DISPATCH_CASES_16(I) \
+    ___PRO_CLOSED_DISPATCH_CASES_4(I) \
+    ___PRO_CLOSED_DISPATCH_CASES_4((I) + 4u) \
+    ___PRO_CLOSED_DISPATCH_CASES_4((I) + 8u) \
+    ___PRO_CLOSED_DISPATCH_CASES_4((I) + 12u)
+#define ___PRO_CLOSED_DISPATCH_CASES_64(I) \
+    ___PRO_CLOSED_DISPATCH_CASES_16(I) \
+    ___PRO_CLOSED_DISPATCH_CASES_16((I) + 16u) \
+    ___PRO_CLOSED_DISPATCH_CASES_16((I) + 32u) \
+    ___PRO_CLOSED_DISPATCH_CASES_16((I) + 48u)
+#define ___PRO_CLOSED_DISPATCH_CASES_256(I) \
+    ___PRO_CLOSED_DISPATCH_CASES_64(I) \
+    ___PRO_CLOSED_DISPATCH_CASES_64((I) + 64u) \
+    ___PRO_CLOSED_DISPATCH_CASES_64((I) + 128u) \
+    ___PRO_CLOSED_DISPATCH_CASES_64((I) + 192u)
+
 template <class F>
 struct proxy_helper {
   static inline const auto& get_meta(const proxy<F>& p) noexcept {
     assert(p.has_value());
     return *p.meta_.operator->();
   }
-  template <class C, class O, qualifier_type Q, class... Args>
-  static decltype(auto) invoke(add_qualifier_t<proxy<F>, Q> p, Args&&... args) {
-    auto dispatcher = get_meta(p)
-        .template dispatcher_meta<typename overload_traits<O>
+  template <class C, class O>
+  static auto get_dispatcher(const typename facade_traits<F>::meta& meta)
+      noexcept {
+    return meta.template dispatcher_meta<typename overload_traits<O>
         ::template meta_provider<C::is_direct, typename C::dispatch_type>>
         ::dispatcher;
+  }
+#if __STDC_HOSTED__
+  template <class C, class O>
+  static auto get_bulk_dispatcher(const typename facade_traits<F>::meta& meta)
+      noexcept {
+    return meta.template dispatcher_meta<typename overload_traits<O>
+        ::template bulk_meta_provider<typename C::dispatch_type>>::dispatcher;
+  }
+#endif  // __STDC_HOSTED__
+  template <class C, class O, qualifier_type Q, std::size_t I, class... Args>
+  static decltype(auto) closed_call(add_qualifier_t<std::byte, Q> self,
+      Args&&... args) {
+    constexpr auto dispatcher = overload_traits<O>::template meta_provider<
+        C::is_direct, typename C::dispatch_type>::template get<
+            std::tuple_element_t<I, typename closed_traits<F>::ptr_types>>();
+    return dispatcher(std::forward<add_qualifier_t<std::byte, Q>>(self),
+        std::forward<Args>(args)...);
+  }
+  template <class C, class O, qualifier_type Q, std::size_t B, class... Args>
+  static decltype(auto) closed_dispatch(std::size_t index,
+      add_qualifier_t<std::byte, Q> self, Args&&... args) {
+    constexpr std::size_t N =
+        std::tuple_size_v<typename closed_traits<F>::ptr_types>;
+    switch (index - B) {
+      ___PRO_CLOSED_DISPATCH_CASES_256(0u)
+      default:
+        if constexpr (B + 256u < N) {
+          return closed_dispatch<C, O, Q, B + 256u>(index,
+              std::forward<add_qualifier_t<std::byte, Q>>(self),
+              std::forward<Args>(args)...);
+        } else {
+          ___PRO_UNREACHABLE();
+        }
+    }
+  }
+  template <class C, class O, qualifier_type Q, class... Args>
+  static decltype(auto) dispatch(add_qualifier_t<proxy<F>, Q> p,
+      Args&&... args) {
+    if constexpr (facade_traits<F>::is_closed) {
+      assert(p.has_value());
+      return closed_dispatch<C, O, Q, 0u>(p.meta_.index(),
+          std::forward<add_qualifier_t<std::byte, Q>>(*p.ptr_),
+          std::forward<Args>(args)...);
+    } else {
+      return get_dispatcher<C, O>(get_meta(p))(
+          std::forward<add_qualifier_t<std::byte, Q>>(*p.ptr_),
+          std::forward<Args>(args)...);
+    }
+  }
+  template <class C, class O, qualifier_type Q, class... Args>
+  static decltype(auto) invoke(add_qualifier_t<proxy<F>, Q> p, Args&&... args) {
     if constexpr (C::is_direct &&
         overload_traits<O>::qualifier == qualifier_type::rv) {
+      assert(p.has_value());
       meta_ptr_reset_guard guard{p.meta_};
-      return dispatcher(std::forward<add_qualifier_t<std::byte, Q>>(*p.ptr_),
+      return dispatch<C, O, Q>(std::forward<add_qualifier_t<proxy<F>, Q>>(p),
           std::forward<Args>(args)...);
     } else {
-      return dispatcher(std::forward<add_qualifier_t<std::byte, Q>>(*p.ptr_),
+      return dispatch<C, O, Q>(std::forward<add_qualifier_t<proxy<F>, Q>>(p),
           std::forward<Args>(args)...);
     }
   }
+  template <class C, class O, class It, class S, class... Args>
+  static void invoke_batch(It first, S last, Args&... args) {
+    while (first != last) {
+      const void* identity = (*first).meta_.identity();
+      auto dispatcher = get_dispatcher<C, O>(get_meta(*first));
+      do {
+        dispatcher(*(*first).ptr_, args...);
+      } while (++first != last && identity != nullptr &&
+          (*first).meta_.identity() == identity);
+    }
+  }
+  static void prefetch(const proxy<F>& p) noexcept {
+    if (!p.meta_.has_value()) { return; }
+    if constexpr (embedded_meta_facade<F>) {
+      // The header of the block references the meta and precedes the object
+      ___PRO_PREFETCH(p.meta_.block());
+    } else if constexpr (facade_traits<F>::is_closed) {
+      // The object is stored inplace
+      ___PRO_PREFETCH(p.meta_.operator->());
+    } else if constexpr (!std::is_void_v<
+        typename facade_traits<F>::prefetch_meta>) {
+      // Only the meta knows where the pointer stores the address of the object
+      ___PRO_PREFETCH(p.meta_.operator->());
+      p.meta_->prefetch_meta::prefetcher(*p.ptr_);
+    }
+  }
+  static const void* get_identity(const proxy<F>& p) noexcept
+      { return p.meta_.identity(); }
+  template <class P>
+  static bool is(const proxy<F>& p) noexcept
+      { return p.meta_.template is<P>(); }
+  static const std::byte& get_storage(const proxy<F>& p) noexcept
+      { return *p.ptr_; }
+  static const facade_meta_ptr<F>& get_meta_ptr(const proxy<F>& p) noexcept
+      { return p.meta_; }
+  template <class MP>
+  static auto get_embedded_storage(MP& meta) noexcept {
+    // The meta pointer is always the meta_ member of a proxy, see access below
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif  // defined(__GNUC__)
+    return reinterpret_cast<std::conditional_t<std::is_const_v<MP>,
+        const std::byte*, std::byte*>>(std::addressof(meta)) -
+        offsetof(proxy<F>, meta_) + offsetof(proxy<F>, ptr_);
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif  // defined(__GNUC__)
+  }
+  // Skips the proxies of trivially destructible pointers by comparing the
+  // dispatcher instead of calling it, like the destructor of proxy
+  static void destroy_range(proxy<F>* first, proxy<F>* last)
+      noexcept(F::constraints.destructibility >= constraint_level::nothrow) {
+    if constexpr (F::constraints.destructibility !=
+        constraint_level::trivial) {
+      for (; first != last; ++first) {
+        if (first->meta_.has_value() && !first->has_trivial_destruction()) {
+          first->meta_->facade_traits<F>::destructibility_meta::dispatcher(
+              *first->ptr_);
+        }
+      }
+    }
+  }
+#if __STDC_HOSTED__
+  // Relocates n proxies from src to dst, where the ranges may overlap. The
+  // objects in the source range are left without their lifetime ended
+  static void relocate(proxy<F>* dst, proxy<F>* src, std::size_t n)
+      noexcept {
+    if (dst == src) { return; }
+    if constexpr (F::constraints.relocatability == constraint_level::trivial ||
+        F::constraints.copyability == constraint_level::trivial) {
+      relocate_bitwise(dst, src, n);
+    } else if (dst < src) {
+      // Each run only overwrites the sources that are already relocated
+      for (std::size_t i = 0u; i < n;) {
+        std::size_t j = i;
+        while (j < n && is_bitwise_relocatable(src[j])) { ++j; }
+        relocate_bitwise(dst + i, src + i, j - i);
+        if (j < n) { relocate(dst + j, src + j); ++j; }
+        i = j;
+      }
+    } else {
+      for (std::size_t i = n; i > 0u;) {
+        std::size_t j = i;
+        while (j > 0u && is_bitwise_relocatable(src[j - 1u])) { --j; }
+        relocate_bitwise(dst + j, src + j, i - j);
+        if (j > 0u) { --j; relocate(dst + j, src + j); }
+        i = j;
+      }
+    }
+  }
+  static bool is_bitwise_relocatable(const proxy<F>& p) noexcept
+      { return !p.meta_.has_value() || p.has_trivial_relocation(); }
+  static void relocate_bitwise(proxy<F>* dst, proxy<F>* src, std::size_t n)
+      noexcept {
+    if (n != 0u) {
+      std::memmove(static_cast<void*>(dst), static_cast<void*>(src),
+          sizeof(proxy<F>) * n);
+    }
+  }
+  // Requires a value that is not bitwise relocatable
+  static void relocate(proxy<F>* dst, proxy<F>* src) noexcept {
+    proxy<F>* result = std::construct_at(dst);
+    src->meta_->facade_traits<F>::relocatability_meta::dispatcher(
+        *result->ptr_, *src->ptr_);
+    result->meta_ = src->meta_;
+  }
+#endif  // __STDC_HOSTED__
+  // The meta of F leads with the meta of B (see upcastable_facade), so that the
+  // proxy of B refers to that subobject of the meta of F
+  template <class B>
+  static proxy<B> upcast(const proxy<F>& p)
+      noexcept(F::constraints.copyability >= constraint_level::nothrow) {
+    proxy<B> result;
+    if (p.meta_.has_value()) {
+      std::byte& storage = proxy_helper<B>::get_storage(result);
+      if constexpr (F::constraints.copyability == constraint_level::trivial) {
+        copy_ptr_bytes<sizeof(p.ptr_)>(&storage, p.ptr_);
+      } else if (p.has_trivial_copy()) {
+        copy_ptr_bytes<sizeof(p.ptr_)>(&storage, p.ptr_);
+      } else {
+        p.meta_->facade_traits<F>::copyability_meta::dispatcher(
+            storage, *p.ptr_);
+      }
+      proxy_helper<B>::set_meta(result, *p.meta_.operator->());
+    }
+    return result;
+  }
+  template <class B>
+  static proxy<B> upcast(proxy<F>&& p)
+      noexcept(F::constraints.relocatability >= constraint_level::nothrow) {
+    proxy<B> result;
+    if (p.meta_.has_value()) {
+      meta_ptr_reset_guard guard{p.meta_};
+      std::byte& storage = proxy_helper<B>::get_storage(result);
+      if constexpr (F::constraints.relocatability ==
+          constraint_level::trivial) {
+        copy_ptr_bytes<sizeof(p.ptr_)>(&storage, p.ptr_);
+      } else if (p.has_trivial_relocation()) {
+        copy_ptr_bytes<sizeof(p.ptr_)>(&storage, p.ptr_);
+      } else {
+        p.meta_->facade_traits<F>::relocatability_meta::dispatcher(
+            storage, *p.ptr_);
+      }
+      proxy_helper<B>::set_meta(result, *p.meta_.operator->());
+    }
+    return result;
+  }
+  static std::byte& get_storage(proxy<F>& p) noexcept { return *p.ptr_; }
+  static void set_meta(proxy<F>& p, const typename facade_traits<F>::meta& meta)
+      noexcept { p.meta_ = facade_meta_ptr<F>{&meta}; }
+  static proxy<F> lock(const facade_meta_ptr<F>& meta,
+      bool (*locker)(std::byte&, void*) noexcept, void* block) noexcept {
+    proxy<F> result;
+    if (locker(*result.ptr_, block)) { result.meta_ = meta; }
+    return result;
+  }
+  template <class P, qualifier_type Q>
+  static add_qualifier_t<P, Q> get_ptr(add_qualifier_t<proxy<F>, Q> p)
+      noexcept {
+    return std::forward<add_qualifier_t<P, Q>>(*std::launder(
+        reinterpret_cast<add_qualifier_ptr_t<P, Q>>(p.ptr_)));
+  }
   template <class A, qualifier_type Q>
   static add_qualifier_t<proxy<F>, Q> access(add_qualifier_t<A, Q> a) {
     if constexpr (std::is_base_of_v<A, proxy<F>>) {
       return static_cast<add_qualifier_t<proxy<F>, Q>>(
           std::forward<add_qualifier_t<A, Q>>(a));
     } else {
+      // The proxy may not be standard-layout when a direct meta pointer
+      // combines several dispatchers, but offsetof is well-defined for it on
+      // every supported compiler as there is no virtual base
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif  // defined(__GNUC__)
       return reinterpret_cast<add_qualifier_t<proxy<F>, Q>>(
           *(reinterpret_cast<add_qualifier_ptr_t<std::byte, Q>>(
               static_cast<add_qualifier_ptr_t<
                   typename facade_traits<F>::indirect_accessor, Q>>(
                       std::addressof(a))) - offsetof(proxy<F>, ia_)));
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif  // defined(__GNUC__)
     }
   }
 };
 
+#undef ___PRO_PREFETCH
+#undef ___PRO_CLOSED_DISPATCH_CASES_256
+#undef ___PRO_CLOSED_DISPATCH_CASES_64
+#undef ___PRO_CLOSED_DISPATCH_CASES_16
+#undef ___PRO_CLOSED_DISPATCH_CASES_4
+#undef ___PRO_CLOSED_DISPATCH_CASE
+
 }  // namespace details
 
 template <class F>
@@ -612,11 +1437,13 @@ concept facade = details::facade_traits<F>::applicable;
 template <class P, class F>
 concept proxiable = facade<F> && sizeof(P) <= F::constraints.max_size &&
     alignof(P) <= F::constraints.max_align &&
+    details::meta_applicable_ptr<F, P> &&
     details::has_copyability<P>(F::constraints.copyability) &&
     details::has_relocatability<P>(F::constraints.relocatability) &&
     details::has_destructibility<P>(F::constraints.destructibility) &&
     details::facade_traits<F>::template conv_applicable_ptr<P> &&
-    details::facade_traits<F>::template refl_applicable_ptr<P>;
+    details::facade_traits<F>::template refl_applicable_ptr<P> &&
+    details::facade_traits<F>::template closed_applicable_ptr<P>;
 
 template <class F>
 class proxy : public details::facade_traits<F>::base {
@@ -634,12 +1461,16 @@ class proxy : public details::facade_traits<F>::base {
       requires(F::constraints.copyability == constraint_level::nontrivial ||
           F::constraints.copyability == constraint_level::nothrow) {
     if (rhs.meta_.has_value()) {
-      rhs.meta_->_Traits::copyability_meta::dispatcher(*ptr_, *rhs.ptr_);
+      if (rhs.has_trivial_copy()) {
+        details::copy_ptr_bytes<sizeof(ptr_)>(ptr_, rhs.ptr_);
+      } else {
+        rhs.meta_->_Traits::copyability_meta::dispatcher(*ptr_, *rhs.ptr_);
+      }
       meta_ = rhs.meta_;
     }
   }
   proxy(proxy&& rhs)
-      noexcept(F::constraints.relocatability == constraint_level::nothrow)
+      noexcept(F::constraints.relocatability >= constraint_level::nothrow)
       requires(F::constraints.relocatability >= constraint_level::nontrivial &&
           F::constraints.copyability != constraint_level::trivial) {
     if (rhs.meta_.has_value()) {
@@ -647,6 +1478,8 @@ class proxy : public details::facade_traits<F>::base {
       if constexpr (F::constraints.relocatability ==
           constraint_level::trivial) {
         std::ranges::uninitialized_copy(rhs.ptr_, ptr_);
+      } else if (rhs.has_trivial_relocation()) {
+        details::copy_ptr_bytes<sizeof(ptr_)>(ptr_, rhs.ptr_);
       } else {
         rhs.meta_->_Traits::relocatability_meta::dispatcher(*ptr_, *rhs.ptr_);
       }
@@ -724,7 +1557,7 @@ class proxy : public details::facade_traits<F>::base {
   ~proxy() noexcept(F::constraints.destructibility == constraint_level::nothrow)
       requires(F::constraints.destructibility == constraint_level::nontrivial ||
           F::constraints.destructibility == constraint_level::nothrow) {
-    if (meta_.has_value()) {
+    if (meta_.has_value() && !has_trivial_destruction()) {
       meta_->_Traits::destructibility_meta::dispatcher(*ptr_);
     }
   }
@@ -743,8 +1576,14 @@ class proxy : public details::facade_traits<F>::base {
     if constexpr (F::constraints.relocatability == constraint_level::trivial ||
         F::constraints.copyability == constraint_level::trivial) {
       std::swap(meta_, rhs.meta_);
-      std::swap(ptr_, rhs.ptr);
+      std::swap(ptr_, rhs.ptr_);
     } else {
+      if ((!meta_.has_value() || has_trivial_relocation()) &&
+          (!rhs.meta_.has_value() || rhs.has_trivial_relocation())) {
+        std::swap(meta_, rhs.meta_);
+        std::swap(ptr_, rhs.ptr_);
+        return;
+      }
       if (meta_.has_value()) {
         if (rhs.meta_.has_value()) {
           proxy temp = std::move(*this);
@@ -786,6 +1625,21 @@ class proxy : public details::facade_traits<F>::base {
   auto&& operator*() const&& noexcept requires(_Traits::has_indirection)
       { return std::forward<const typename _Traits::indirect_accessor>(ia_); }
 
+  template <class F2>
+  operator proxy<F2>() const&
+      noexcept(F::constraints.copyability >= constraint_level::nothrow)
+      requires(details::upcastable_facade<F, F2> &&
+          F::constraints.copyability != constraint_level::none)
+      { return details::proxy_helper<F>::template upcast<F2>(*this); }
+  template <class F2>
+  operator proxy<F2>() &&
+      noexcept(F::constraints.relocatability >= constraint_level::nothrow)
+      requires(details::upcastable_facade<F, F2> &&
+          F::constraints.relocatability >= constraint_level::nontrivial &&
+          F::constraints.copyability != constraint_level::trivial) {
+    return details::proxy_helper<F>::template upcast<F2>(std::move(*this));
+  }
+
   friend void swap(proxy& lhs, proxy& rhs) noexcept(noexcept(lhs.swap(rhs)))
       { lhs.swap(rhs); }
   friend bool operator==(const proxy& lhs, std::nullptr_t) noexcept
@@ -798,16 +1652,42 @@ class proxy : public details::facade_traits<F>::base {
         reinterpret_cast<P*>(ptr_), std::forward<Args>(args)...);
     if constexpr (requires { (bool)result; })
         { assert((bool)result); }
-    meta_ = details::meta_ptr<typename _Traits::meta>{std::in_place_type<P>};
+    meta_ = details::facade_meta_ptr<F>{std::in_place_type<P>};
     return result;
   }
+  // Require a value. Trivial lifetime operations of the contained pointer are
+  // recognized by their dispatchers, which no pointer type has otherwise
+  bool has_trivial_copy() const noexcept {
+    return meta_->_Traits::copyability_meta::dispatcher ==
+        &details::copying_default_dispatcher<
+            F::constraints.max_size, F::constraints.max_align>;
+  }
+  bool has_trivial_relocation() const noexcept {
+    return meta_->_Traits::relocatability_meta::dispatcher ==
+        &details::copying_default_dispatcher<
+            F::constraints.max_size, F::constraints.max_align>;
+  }
+  bool has_trivial_destruction() const noexcept {
+    return meta_->_Traits::destructibility_meta::dispatcher ==
+        &details::destruction_default_dispatcher;
+  }
 
   [[___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
   typename _Traits::indirect_accessor ia_;
-  details::meta_ptr<typename _Traits::meta> meta_;
+  [[___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+  details::facade_meta_ptr<F> meta_;
   alignas(F::constraints.max_align) std::byte ptr_[F::constraints.max_size];
 };
 
+template <class F>
+void proxy_prefetch(const proxy<F>& p) noexcept
+    { details::proxy_helper<F>::prefetch(p); }
+
+template <class F>
+void destroy_range(proxy<F>* first, proxy<F>* last)
+    noexcept(F::constraints.destructibility >= constraint_level::nothrow)
+    { details::proxy_helper<F>::destroy_range(first, last); }
+
 template <class C, class O, class F, class... Args>
 decltype(auto) proxy_invoke(proxy<F>& p, Args&&... args) {
   return details::proxy_helper<F>::template invoke<
@@ -831,14 +1711,231 @@ decltype(auto) proxy_invoke(const proxy<F>&& p, Args&&... args) {
       std::forward<const proxy<F>>(p), std::forward<Args>(args)...);
 }
 
-template <class F, class A>
-proxy<F>& access_proxy(A& a) noexcept {
-  return details::proxy_helper<F>::template access<
-      A, details::qualifier_type::lv>(a);
-}
-template <class F, class A>
-const proxy<F>& access_proxy(const A& a) noexcept {
-  return details::proxy_helper<F>::template access<
+namespace details {
+
+template <class P> struct proxy_traits : inapplicable_traits {};
+template <class F>
+struct proxy_traits<proxy<F>> : applicable_traits
+    { using facade_type = F; };
+template <class R>
+using range_facade_t = typename proxy_traits<
+    std::remove_cvref_t<std::ranges::range_reference_t<R>>>::facade_type;
+
+template <class R, class O>
+concept batch_invocable_range = std::ranges::input_range<R> &&
+    std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> &&
+    proxy_traits<std::remove_cvref_t<std::ranges::range_reference_t<R>>>
+        ::applicable &&
+    (overload_traits<O>::qualifier == qualifier_type::const_lv ||
+        (overload_traits<O>::qualifier == qualifier_type::lv &&
+            !std::is_const_v<std::remove_reference_t<
+                std::ranges::range_reference_t<R>>>));
+
+template <class R>
+concept prefetchable_range = std::ranges::random_access_range<R> &&
+    std::ranges::common_range<R> &&
+    std::is_lvalue_reference_v<std::ranges::range_reference_t<R>> &&
+    proxy_traits<std::remove_cvref_t<std::ranges::range_reference_t<R>>>
+        ::applicable;
+
+template <std::ranges::view V> requires(prefetchable_range<V>)
+class prefetch_view : public std::ranges::view_interface<prefetch_view<V>> {
+  using base_iterator = std::ranges::iterator_t<V>;
+
+ public:
+  class iterator {
+   public:
+    using iterator_concept = std::forward_iterator_tag;
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::ranges::range_value_t<V>;
+    using difference_type = std::ranges::range_difference_t<V>;
+
+    iterator() = default;
+    iterator(base_iterator it, base_iterator last, difference_type distance)
+        noexcept : it_(std::move(it)), last_(std::move(last)),
+        distance_(distance) {}
+
+    std::ranges::range_reference_t<V> operator*() const { return *it_; }
+    iterator& operator++() {
+      ++it_;
+      if (last_ - it_ > distance_) { proxy_prefetch(it_[distance_]); }
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator result = *this;
+      ++*this;
+      return result;
+    }
+    bool operator==(const iterator& rhs) const { return it_ == rhs.it_; }
+
+   private:
+    base_iterator it_{};
+    base_iterator last_{};
+    difference_type distance_ = 0;
+  };
+
+  prefetch_view() = default;
+  prefetch_view(V base, std::ranges::range_difference_t<V> distance)
+      : base_(std::move(base)), distance_(distance) {}
+
+  iterator begin() {
+    base_iterator first = std::ranges::begin(base_);
+    base_iterator last = std::ranges::end(base_);
+    for (auto it = first; it != last && it - first < distance_; ++it)
+        { proxy_prefetch(*it); }
+    return iterator{first, last, distance_};
+  }
+  iterator end() {
+    base_iterator last = std::ranges::end(base_);
+    return iterator{last, last, distance_};
+  }
+
+ private:
+  V base_;
+  std::ranges::range_difference_t<V> distance_ = 0;
+};
+
+}  // namespace details
+
+template <std::ranges::viewable_range R>
+    requires(details::prefetchable_range<R>)
+auto prefetched(R&& range, std::ranges::range_difference_t<R> distance) {
+  return details::prefetch_view<std::views::all_t<R>>{
+      std::views::all(std::forward<R>(range)), distance};
+}
+
+struct group_by_type_t { explicit group_by_type_t() = default; };
+inline constexpr group_by_type_t group_by_type{};
+
+template <class C, class O, class R, class... Args>
+void proxy_invoke_batch(R&& range, Args&&... args)
+    requires(details::batch_invocable_range<R, O>) {
+  details::proxy_helper<details::range_facade_t<R>>::template invoke_batch<
+      C, O>(std::ranges::begin(range), std::ranges::end(range), args...);
+}
+#if __STDC_HOSTED__
+template <class C, class O, class R, class... Args>
+void proxy_invoke_batch(group_by_type_t, R&& range, Args&&... args)
+    requires(details::batch_invocable_range<R, O> &&
+        std::ranges::random_access_range<R> &&
+        std::permutable<std::ranges::iterator_t<R>>) {
+  std::ranges::stable_sort(range, std::less<const void*>{},
+      &details::proxy_helper<details::range_facade_t<R>>::get_identity);
+  proxy_invoke_batch<C, O>(range, args...);
+}
+
+struct parallel_t {
+  constexpr explicit parallel_t(std::size_t count = 0u) noexcept
+      : thread_count(count) {}
+
+  std::size_t thread_count;  // 0 denotes std::thread::hardware_concurrency()
+};
+inline constexpr parallel_t parallel{};
+
+namespace details {
+
+// Each thread is expected to claim several chunks, so that a thread that
+// finishes cheap chunks early takes over more of the remaining ones
+constexpr std::size_t parallel_chunks_per_thread = 8u;
+
+// Creating threads requires <thread>, which is only included when
+// PRO_ENABLE_PARALLEL is defined. The runner is always declared and named with
+// a dependent type, so that only using a parallel overload without the macro is
+// ill-formed
+template <class T>
+struct parallel_runner;
+#if defined(PRO_ENABLE_PARALLEL)
+template <class T>
+struct parallel_runner {
+  static std::size_t thread_count(parallel_t policy) noexcept {
+    if (policy.thread_count != 0u) { return policy.thread_count; }
+    unsigned hardware = std::thread::hardware_concurrency();
+    return hardware != 0u ? hardware : 1u;
+  }
+
+  // Runs task(i) for every i in [0, n) on up to thread_count threads including
+  // the calling one. The first exception thrown by a task is rethrown after all
+  // the threads have finished, and no further tasks are started after it
+  template <class U>
+  static void run(std::size_t thread_count, std::size_t n, const U& task) {
+    std::atomic<std::size_t> next{0u};
+    std::atomic_flag failed;
+    std::exception_ptr error;
+    auto worker = [&]() noexcept {
+      try {
+        for (std::size_t i = next.fetch_add(1u, std::memory_order_relaxed);
+            i < n; i = next.fetch_add(1u, std::memory_order_relaxed))
+            { task(i); }
+      } catch (...) {
+        next.store(n, std::memory_order_relaxed);
+        if (!failed.test_and_set()) { error = std::current_exception(); }
+      }
+    };
+    {
+      std::vector<std::jthread> threads;
+      std::size_t extra = (thread_count < n ? thread_count : n);
+      if (extra > 0u) { --extra; }
+      threads.reserve(extra);
+      for (std::size_t i = 0u; i < extra; ++i)
+          { threads.emplace_back(worker); }
+      worker();
+    }
+    if (error) { std::rethrow_exception(error); }
+  }
+};
+#endif  // defined(PRO_ENABLE_PARALLEL)
+
+// Splits the range into chunks of about the same size, moving each boundary
+// forward past the run of proxies created from the same pointer type. A run
+// longer than a chunk is split, costing one more dispatcher resolution
+template <class F, class It>
+std::vector<std::size_t> parallel_run_bounds(It first, std::size_t n,
+    std::size_t chunk_count) {
+  std::vector<std::size_t> result{0u};
+  std::size_t step = (n + chunk_count - 1u) / chunk_count;
+  for (std::size_t b = step; b < n; b = result.back() + step) {
+    const void* identity = proxy_helper<F>::get_identity(first[b - 1u]);
+    std::size_t e = b, limit = std::min(n, b + step);
+    while (e < limit && identity != nullptr &&
+        proxy_helper<F>::get_identity(first[e]) == identity) { ++e; }
+    if (e == n) { break; }
+    result.push_back(e < limit ? e : b);
+  }
+  result.push_back(n);
+  return result;
+}
+
+}  // namespace details
+
+template <class C, class O, class R, class... Args>
+void proxy_invoke_batch(parallel_t policy, R&& range, Args&&... args)
+    requires(details::batch_invocable_range<R, O> &&
+        std::ranges::random_access_range<R> &&
+        std::ranges::sized_range<R> &&
+        details::overload_traits<O>::template const_lv_invocable<Args...>) {
+  using F = details::range_facade_t<R>;
+  using runner = details::parallel_runner<F>;
+  auto first = std::ranges::begin(range);
+  std::size_t thread_count = runner::thread_count(policy);
+  std::vector<std::size_t> bounds = details::parallel_run_bounds<F>(first,
+      static_cast<std::size_t>(std::ranges::size(range)),
+      thread_count * details::parallel_chunks_per_thread);
+  runner::run(thread_count, bounds.size() - 1u,
+      [&](std::size_t i) {
+        details::proxy_helper<F>::template invoke_batch<C, O>(
+            first + bounds[i], first + bounds[i + 1u], std::as_const(args)...);
+      });
+}
+#endif  // __STDC_HOSTED__
+
+template <class F, class A>
+proxy<F>& access_proxy(A& a) noexcept {
+  return details::proxy_helper<F>::template access<
+      A, details::qualifier_type::lv>(a);
+}
+template <class F, class A>
+const proxy<F>& access_proxy(const A& a) noexcept {
+  return details::proxy_helper<F>::template access<
       A, details::qualifier_type::const_lv>(a);
 }
 template <class F, class A>
@@ -858,6 +1955,256 @@ const R& proxy_reflect(const proxy<F>& p) noexcept
 
 namespace details {
 
+struct type_tag {
+  // Keeps the address of each instance unique under identical data folding
+  const type_tag* self;
+  const type_tag* unqualified;
+};
+template <class T>
+inline constexpr type_tag type_tag_of{
+    &type_tag_of<T>, &type_tag_of<std::remove_cv_t<T>>};
+
+// Constrains typeid_reflection, so that checking proxiable with a pointer type
+// that has no element type is not a hard error
+template <class P>
+concept lvalue_dereferenceable =
+    requires(P& ptr) { *ptr; } &&
+    std::is_lvalue_reference_v<decltype(*std::declval<P&>())>;
+template <class P>
+using ptr_element_t = std::remove_reference_t<decltype(*std::declval<P&>())>;
+template <class P>
+const void* element_address(const std::byte& self, bool as_mutable) {
+  const P& ptr = *std::launder(reinterpret_cast<const P*>(&self));
+  if constexpr (requires { *ptr; }) {
+    // A pointer may behave differently when dereferenced as non-const (e.g.,
+    // copy-on-write), so the storage is only treated as mutable on request
+    if (!as_mutable) {
+      return const_cast<const void*>(
+          static_cast<const volatile void*>(std::addressof(*ptr)));
+    }
+  }
+  return const_cast<const void*>(static_cast<const volatile void*>(
+      std::addressof(*const_cast<P&>(ptr))));
+}
+
+struct typeid_reflection {
+  template <lvalue_dereferenceable P>
+  constexpr explicit typeid_reflection(std::in_place_type_t<P>) noexcept
+      : tag(&type_tag_of<ptr_element_t<P>>), address(&element_address<P>) {}
+
+  const type_tag* tag;
+  const void* (*address)(const std::byte&, bool);
+};
+
+template <class F>
+concept facade_with_typeid = facade<F> &&
+    std::is_base_of_v<typeid_reflection, typename facade_traits<F>::meta>;
+
+template <class T>
+bool typeid_matches(const type_tag* tag) noexcept {
+  if (tag == &type_tag_of<T>) { return true; }
+  if constexpr (std::is_const_v<T>) {
+    if (typeid_matches<std::remove_const_t<T>>(tag)) { return true; }
+  }
+  if constexpr (std::is_volatile_v<T>) {
+    if (typeid_matches<std::remove_volatile_t<T>>(tag)) { return true; }
+  }
+  return false;
+}
+template <class T, class F>
+T* proxy_cast_impl(const proxy<F>& p, bool as_mutable) {
+  if (!p.has_value()) { return nullptr; }
+  const typeid_reflection& r = proxy_reflect<typeid_reflection>(p);
+  if (!typeid_matches<T>(r.tag)) { return nullptr; }
+  return static_cast<T*>(const_cast<void*>(
+      r.address(proxy_helper<F>::get_storage(p), as_mutable)));
+}
+
+}  // namespace details
+
+class type_id {
+ public:
+  constexpr type_id() noexcept : tag_(&details::type_tag_of<void>) {}
+  constexpr type_id(const type_id&) noexcept = default;
+  constexpr type_id& operator=(const type_id&) noexcept = default;
+
+  std::size_t hash_code() const noexcept {
+    return static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(tag_));
+  }
+
+  friend bool operator==(const type_id&, const type_id&) noexcept = default;
+  friend std::strong_ordering operator<=>(
+      const type_id& lhs, const type_id& rhs) noexcept
+      { return std::compare_three_way{}(lhs.tag_, rhs.tag_); }
+
+ private:
+  constexpr explicit type_id(const details::type_tag* tag) noexcept
+      : tag_(tag) {}
+
+  template <class T> friend constexpr type_id type_id_of() noexcept;
+  template <class F> friend type_id proxy_typeid(const proxy<F>& p) noexcept
+      requires(details::facade_with_typeid<F>);
+
+  const details::type_tag* tag_;
+};
+
+template <class T>
+constexpr type_id type_id_of() noexcept
+    { return type_id{&details::type_tag_of<std::remove_cvref_t<T>>}; }
+
+template <class F>
+type_id proxy_typeid(const proxy<F>& p) noexcept
+    requires(details::facade_with_typeid<F>) {
+  if (!p.has_value()) { return type_id_of<void>(); }
+  return type_id{
+      proxy_reflect<details::typeid_reflection>(p).tag->unqualified};
+}
+
+template <class T, class F>
+T* proxy_cast(proxy<F>* p) noexcept
+    requires(details::facade_with_typeid<F> && std::is_object_v<T>) {
+  return p == nullptr ? nullptr :
+      details::proxy_cast_impl<T>(*p, !std::is_const_v<T>);
+}
+template <class T, class F>
+const T* proxy_cast(const proxy<F>* p) noexcept
+    requires(details::facade_with_typeid<F> && std::is_object_v<T>) {
+  return p == nullptr ? nullptr :
+      details::proxy_cast_impl<const T>(*p, false);
+}
+
+#if __STDC_HOSTED__
+class bad_proxy_cast : public std::bad_cast {
+ public:
+  const char* what() const noexcept override { return "pro::bad_proxy_cast"; }
+};
+
+template <class T, class F>
+T proxy_cast(proxy<F>& p)
+    requires(details::facade_with_typeid<F> &&
+        std::is_constructible_v<T, std::remove_cvref_t<T>&>) {
+  auto* result = proxy_cast<std::remove_cvref_t<T>>(&p);
+  if (result == nullptr) { throw bad_proxy_cast{}; }
+  return static_cast<T>(*result);
+}
+template <class T, class F>
+T proxy_cast(const proxy<F>& p)
+    requires(details::facade_with_typeid<F> &&
+        std::is_constructible_v<T, const std::remove_cvref_t<T>&>) {
+  auto* result = proxy_cast<std::remove_cvref_t<T>>(&p);
+  if (result == nullptr) { throw bad_proxy_cast{}; }
+  return static_cast<T>(*result);
+}
+template <class T, class F>
+T proxy_cast(proxy<F>&& p)
+    requires(details::facade_with_typeid<F> &&
+        std::is_constructible_v<T, std::remove_cvref_t<T>>) {
+  auto* result = proxy_cast<std::remove_cvref_t<T>>(&p);
+  if (result == nullptr) { throw bad_proxy_cast{}; }
+  return static_cast<T>(std::move(*result));
+}
+#endif  // __STDC_HOSTED__
+
+enum class sharing_policy { atomic, plain };
+
+#if __STDC_HOSTED__
+class arena {
+ public:
+  static constexpr std::size_t default_chunk_size = 4096u;
+
+  explicit arena(std::size_t initial_chunk_size = default_chunk_size) noexcept
+      : head_(nullptr), cur_(nullptr), end_(nullptr),
+        next_chunk_size_(std::max(initial_chunk_size, sizeof(chunk_header))) {}
+  arena(const arena&) = delete;
+  arena& operator=(const arena&) = delete;
+  ~arena() { release_chunks(head_); }
+
+  void* allocate(std::size_t size, std::size_t align) {
+    std::byte* result = nullptr;
+    if (cur_ != nullptr) {
+      // Compares sizes rather than pointers, since aligning may step past the
+      // end of the chunk
+      std::size_t available = static_cast<std::size_t>(end_ - cur_);
+      std::size_t padding = padding_of(cur_, align);
+      if (padding <= available && size <= available - padding) {
+        result = cur_ + padding;
+      }
+    }
+    if (result == nullptr) { result = allocate_from_new_chunk(size, align); }
+    cur_ = result + size;
+    return result;
+  }
+  void reset() noexcept {
+    if (head_ != nullptr) {
+      // Retains the most recent (and largest) chunk for reuse
+      release_chunks(std::exchange(head_->next, nullptr));
+      cur_ = reinterpret_cast<std::byte*>(head_ + 1);
+    }
+  }
+
+ private:
+  struct alignas(std::max_align_t) chunk_header {
+    chunk_header* next;
+    std::byte* end;
+  };
+
+  static std::size_t padding_of(std::byte* ptr, std::size_t align) noexcept {
+    std::uintptr_t value = reinterpret_cast<std::uintptr_t>(ptr);
+    return (align - value % align) % align;
+  }
+  static void release_chunks(chunk_header* head) noexcept {
+    while (head != nullptr) {
+      chunk_header* next = head->next;
+      ::operator delete(head);
+      head = next;
+    }
+  }
+  std::byte* allocate_from_new_chunk(std::size_t size, std::size_t align) {
+    constexpr std::size_t max_size = std::numeric_limits<std::size_t>::max();
+    if (size > max_size - sizeof(chunk_header) - align) {
+      throw std::bad_alloc{};
+    }
+    std::size_t required = sizeof(chunk_header) + size + align;
+    while (next_chunk_size_ < required) {
+      // Stops doubling before it wraps around
+      next_chunk_size_ = next_chunk_size_ > max_size / 2u ?
+          required : next_chunk_size_ * 2u;
+    }
+    chunk_header* chunk = static_cast<chunk_header*>(
+        ::operator new(next_chunk_size_));
+    chunk->next = head_;
+    chunk->end = reinterpret_cast<std::byte*>(chunk) + next_chunk_size_;
+    head_ = chunk;
+    next_chunk_size_ = next_chunk_size_ > max_size / 2u ?
+        max_size : next_chunk_size_ * 2u;
+    end_ = chunk->end;
+    std::byte* result = reinterpret_cast<std::byte*>(chunk + 1);
+    return result + padding_of(result, align);
+  }
+
+  chunk_header* head_;
+  std::byte* cur_;
+  std::byte* end_;
+  std::size_t next_chunk_size_;
+};
+#endif  // __STDC_HOSTED__
+
+namespace details {
+
+template <class T>
+class observer_ptr {
+ public:
+  explicit observer_ptr(T* ptr) noexcept : ptr_(ptr) {}
+
+  T* operator->() noexcept { return ptr_; }
+  const T* operator->() const noexcept { return ptr_; }
+  T& operator*() & noexcept { return *ptr_; }
+  const T& operator*() const& noexcept { return *ptr_; }
+
+ private:
+  T* ptr_;
+};
+
 template <class T>
 class inplace_ptr {
  public:
@@ -961,14 +2308,280 @@ class compact_ptr {
         : value(std::forward<Args>(args)...), alloc(alloc) {}
 
     T value;
+    [[___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+    Alloc alloc;
+  };
+
+  storage* ptr_;
+};
+// Allocates the header referencing the meta in front of the object, so that
+// a proxy with an embedded meta consists of the pointer alone
+template <class M, class T, class Alloc>
+class embedded_ptr {
+ public:
+  template <class... Args>
+  embedded_ptr(const Alloc& alloc, Args&&... args)
+      requires(std::is_constructible_v<T, Args...>)
+      : ptr_(allocate<storage>(alloc, alloc, std::forward<Args>(args)...)) {}
+  embedded_ptr(const embedded_ptr& rhs) requires(std::is_copy_constructible_v<T>)
+      : ptr_(rhs.ptr_ == nullptr ? nullptr : allocate<storage>(rhs.get()->alloc,
+            rhs.get()->alloc, std::as_const(rhs.get()->value))) {}
+  embedded_ptr(embedded_ptr&& rhs) noexcept
+      : ptr_(std::exchange(rhs.ptr_, nullptr)) {}
+  ~embedded_ptr() { if (ptr_ != nullptr) { deallocate(get()->alloc, get()); } }
+
+  T* operator->() noexcept { return &get()->value; }
+  const T* operator->() const noexcept { return &get()->value; }
+  T& operator*() & noexcept { return get()->value; }
+  const T& operator*() const& noexcept { return get()->value; }
+  T&& operator*() && noexcept { return std::forward<T>(get()->value); }
+  const T&& operator*() const&& noexcept
+      { return std::forward<const T>(get()->value); }
+
+ private:
+  struct storage : embedded_header<M> {
+    template <class... Args>
+    explicit storage(const Alloc& alloc, Args&&... args)
+        : embedded_header<M>{&meta_storage<M, embedded_ptr>},
+          value(std::forward<Args>(args)...), alloc(alloc) {}
+
+    T value;
+    [[___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+    Alloc alloc;
+  };
+
+  storage* get() const noexcept { return static_cast<storage*>(ptr_); }
+
+  embedded_header<M>* ptr_;
+};
+
+template <sharing_policy SP> class ref_count;
+template <>
+class ref_count<sharing_policy::atomic> {
+ public:
+  void add() noexcept { strong_.fetch_add(1, std::memory_order_relaxed); }
+  bool try_add() noexcept {
+    long n = strong_.load(std::memory_order_relaxed);
+    do {
+      if (n == 0) { return false; }
+    } while (!strong_.compare_exchange_weak(n, n + 1,
+        std::memory_order_acq_rel, std::memory_order_relaxed));
+    return true;
+  }
+  bool release() noexcept
+      { return strong_.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+  bool unique() const noexcept
+      { return strong_.load(std::memory_order_acquire) == 1; }
+  bool expired() const noexcept
+      { return strong_.load(std::memory_order_acquire) == 0; }
+  void add_weak() noexcept { weak_.fetch_add(1, std::memory_order_relaxed); }
+  bool release_weak() noexcept {
+    // When the count is 1, no other owner can exist, so the atomic
+    // read-modify-write is skipped for objects never observed weakly
+    return weak_.load(std::memory_order_acquire) == 1 ||
+        weak_.fetch_sub(1, std::memory_order_acq_rel) == 1;
+  }
+
+ private:
+  std::atomic<long> strong_{1};
+  std::atomic<long> weak_{1};  // Plus one while strong_ is nonzero
+};
+template <>
+class ref_count<sharing_policy::plain> {
+ public:
+  void add() noexcept { ++strong_; }
+  bool try_add() noexcept { return strong_ != 0 && (++strong_, true); }
+  bool release() noexcept { return --strong_ == 0; }
+  bool unique() const noexcept { return strong_ == 1; }
+  bool expired() const noexcept { return strong_ == 0; }
+  void add_weak() noexcept { ++weak_; }
+  bool release_weak() noexcept { return --weak_ == 0; }
+
+ private:
+  long strong_ = 1;
+  long weak_ = 1;
+};
+struct weak_ops {
+  void* (*get_block)(const std::byte& self) noexcept;
+  void (*add_weak)(void* block) noexcept;
+  void (*release_weak)(void* block) noexcept;
+  bool (*expired)(void* block) noexcept;
+  bool (*lock)(std::byte& self, void* block) noexcept;
+};
+template <class T, class Alloc, sharing_policy SP>
+class shared_compact_ptr {
+  struct storage;
+
+ public:
+  template <class... Args>
+  shared_compact_ptr(const Alloc& alloc, Args&&... args)
+      requires(std::is_constructible_v<T, Args...>)
+      : ptr_(allocate<storage>(alloc, alloc, std::forward<Args>(args)...)) {}
+  shared_compact_ptr(const shared_compact_ptr& rhs) noexcept : ptr_(rhs.ptr_)
+      { if (ptr_ != nullptr) { ptr_->count.add(); } }
+  shared_compact_ptr(shared_compact_ptr&& rhs) noexcept
+      : ptr_(std::exchange(rhs.ptr_, nullptr)) {}
+  ~shared_compact_ptr() {
+    if (ptr_ != nullptr && ptr_->count.release()) {
+      std::destroy_at(&ptr_->value);
+      release_weak(ptr_);
+    }
+  }
+
+  // Shared ownership does not propagate constness or value category to the
+  // shared object, consistent with std::shared_ptr
+  T* operator->() const noexcept { return &ptr_->value; }
+  T& operator*() const noexcept { return ptr_->value; }
+
+ private:
+  struct storage {
+    template <class... Args>
+    explicit storage(const Alloc& alloc, Args&&... args)
+        : value(std::forward<Args>(args)...), alloc(alloc) {}
+    ~storage() {}  // The lifetime of value is managed by the strong count
+
+    union { T value; };
+    [[___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
+    Alloc alloc;
+    ref_count<SP> count;
+  };
+
+  explicit shared_compact_ptr(storage* ptr) noexcept : ptr_(ptr) {}
+
+  static void* get_block(const std::byte& self) noexcept {
+    return std::launder(reinterpret_cast<const shared_compact_ptr*>(&self))
+        ->ptr_;
+  }
+  static void add_weak(void* block) noexcept
+      { static_cast<storage*>(block)->count.add_weak(); }
+  static void release_weak(void* block) noexcept {
+    storage* ptr = static_cast<storage*>(block);
+    if (ptr->count.release_weak()) { deallocate(ptr->alloc, ptr); }
+  }
+  static bool expired(void* block) noexcept
+      { return static_cast<storage*>(block)->count.expired(); }
+  static bool lock(std::byte& self, void* block) noexcept {
+    storage* ptr = static_cast<storage*>(block);
+    if (!ptr->count.try_add()) { return false; }
+    ::new (&self) shared_compact_ptr(ptr);
+    return true;
+  }
+
+  storage* ptr_;
+
+ public:
+  static constexpr weak_ops weak_ops_instance{&get_block, &add_weak,
+      &release_weak, &expired, &lock};
+};
+
+template <class T, class Alloc, sharing_policy SP>
+class cow_compact_ptr {
+ public:
+  template <class... Args>
+  cow_compact_ptr(const Alloc& alloc, Args&&... args)
+      requires(std::is_constructible_v<T, Args...>)
+      : ptr_(allocate<storage>(alloc, alloc, std::forward<Args>(args)...)) {}
+  cow_compact_ptr(const cow_compact_ptr& rhs) noexcept : ptr_(rhs.ptr_)
+      { if (ptr_ != nullptr) { ptr_->count.add(); } }
+  cow_compact_ptr(cow_compact_ptr&& rhs) noexcept
+      : ptr_(std::exchange(rhs.ptr_, nullptr)) {}
+  ~cow_compact_ptr() { release(ptr_); }
+
+  // Only the non-const accessors may write to the object, so they detach
+  // from the other owners by cloning it first
+  const T* operator->() const noexcept { return &ptr_->value; }
+  T* operator->() requires(std::is_copy_constructible_v<T>)
+      { return &unshare().value; }
+  const T& operator*() const& noexcept { return ptr_->value; }
+  T& operator*() & requires(std::is_copy_constructible_v<T>)
+      { return unshare().value; }
+  T&& operator*() && requires(std::is_copy_constructible_v<T>)
+      { return std::forward<T>(unshare().value); }
+  const T&& operator*() const&& noexcept
+      { return std::forward<const T>(ptr_->value); }
+
+ private:
+  struct storage {
+    template <class... Args>
+    explicit storage(const Alloc& alloc, Args&&... args)
+        : value(std::forward<Args>(args)...), alloc(alloc) {}
+
+    T value;
+    [[___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE]]
     Alloc alloc;
+    ref_count<SP> count;
   };
 
+  static void release(storage* ptr) noexcept {
+    if (ptr != nullptr && ptr->count.release()) { deallocate(ptr->alloc, ptr); }
+  }
+  storage& unshare() {
+    if (!ptr_->count.unique()) {
+      storage* copy = allocate<storage>(ptr_->alloc, ptr_->alloc,
+          std::as_const(ptr_->value));
+      release(std::exchange(ptr_, copy));
+    }
+    return *ptr_;
+  }
+
   storage* ptr_;
 };
+
+struct weak_reflection {
+  constexpr weak_reflection() noexcept : ops(nullptr) {}
+  template <class P>
+  constexpr explicit weak_reflection(std::in_place_type_t<P>) noexcept
+      : ops(nullptr) {}
+  template <class T, class Alloc, sharing_policy SP>
+  constexpr explicit weak_reflection(
+      std::in_place_type_t<shared_compact_ptr<T, Alloc, SP>>) noexcept
+      : ops(&shared_compact_ptr<T, Alloc, SP>::weak_ops_instance) {}
+
+  const weak_ops* ops;
+};
+template <class F>
+concept facade_with_weak = facade<F> && !embedded_meta_facade<F> &&
+    std::is_base_of_v<weak_reflection, typename facade_traits<F>::meta>;
+
+template <class T>
+class arena_ptr {
+ public:
+  template <class... Args>
+  arena_ptr(arena& a, Args&&... args)
+      requires(std::is_constructible_v<T, Args...>)
+      : arena_(&a), ptr_(std::construct_at(static_cast<T*>(
+            a.allocate(sizeof(T), alignof(T))), std::forward<Args>(args)...)) {}
+  arena_ptr(const arena_ptr& rhs) requires(std::is_copy_constructible_v<T>)
+      : arena_(rhs.arena_), ptr_(rhs.ptr_ == nullptr ? nullptr :
+            std::construct_at(static_cast<T*>(arena_->allocate(
+                sizeof(T), alignof(T))), std::as_const(*rhs.ptr_))) {}
+  // Destruction is a no-op when T is trivially destructible, so moving the
+  // pointer is trivial and the proxy can relocate it bitwise
+  arena_ptr(arena_ptr&&) noexcept
+      requires(std::is_trivially_destructible_v<T>) = default;
+  arena_ptr(arena_ptr&& rhs) noexcept
+      : arena_(rhs.arena_), ptr_(std::exchange(rhs.ptr_, nullptr)) {}
+  ~arena_ptr() requires(std::is_trivially_destructible_v<T>) = default;
+  ~arena_ptr() { if (ptr_ != nullptr) { std::destroy_at(ptr_); } }
+
+  T* operator->() noexcept { return ptr_; }
+  const T* operator->() const noexcept { return ptr_; }
+  T& operator*() & noexcept { return *ptr_; }
+  const T& operator*() const& noexcept { return *ptr_; }
+  T&& operator*() && noexcept { return std::forward<T>(*ptr_); }
+  const T&& operator*() const&& noexcept
+      { return std::forward<const T>(*ptr_); }
+
+ private:
+  arena* arena_;
+  T* ptr_;
+};
 template <class F, class T, class Alloc, class... Args>
 proxy<F> allocate_proxy_impl(const Alloc& alloc, Args&&... args) {
-  if constexpr (proxiable<allocated_ptr<T, Alloc>, F>) {
+  if constexpr (embedded_meta_facade<F>) {
+    using P = embedded_ptr<typename facade_traits<F>::meta, T, Alloc>;
+    return proxy<F>{std::in_place_type<P>, alloc, std::forward<Args>(args)...};
+  } else if constexpr (proxiable<allocated_ptr<T, Alloc>, F>) {
     return proxy<F>{std::in_place_type<allocated_ptr<T, Alloc>>,
         alloc, std::forward<Args>(args)...};
   } else {
@@ -976,6 +2589,15 @@ proxy<F> allocate_proxy_impl(const Alloc& alloc, Args&&... args) {
         alloc, std::forward<Args>(args)...};
   }
 }
+template <class F, class T>
+struct facade_allocator_traits : std::type_identity<std::allocator<T>> {};
+template <class F, class T>
+    requires(!std::is_void_v<typename F::allocator_type>)
+struct facade_allocator_traits<F, T>
+    : std::type_identity<typename std::allocator_traits<
+          typename F::allocator_type>::template rebind_alloc<T>> {};
+template <class F, class T>
+using facade_allocator_t = typename facade_allocator_traits<F, T>::type;
 template <class F, class T, class... Args>
 proxy<F> make_proxy_impl(Args&&... args) {
   if constexpr (proxiable<inplace_ptr<T>, F>) {
@@ -983,13 +2605,46 @@ proxy<F> make_proxy_impl(Args&&... args) {
         std::forward<Args>(args)...};
   } else {
     return allocate_proxy_impl<F, T>(
-        std::allocator<T>{}, std::forward<Args>(args)...);
+        facade_allocator_t<F, T>{}, std::forward<Args>(args)...);
   }
 }
 #endif  // __STDC_HOSTED__
 
 }  // namespace details
 
+template <class T>
+struct is_trivially_relocatable<details::inplace_ptr<T>>
+    : is_trivially_relocatable<T> {};
+#if __STDC_HOSTED__
+template <class T, class Alloc>
+struct is_trivially_relocatable<details::allocated_ptr<T, Alloc>>
+    : is_trivially_relocatable<Alloc> {};
+template <class T, class Alloc>
+struct is_trivially_relocatable<details::compact_ptr<T, Alloc>>
+    : std::true_type {};
+template <class M, class T, class Alloc>
+struct is_trivially_relocatable<details::embedded_ptr<M, T, Alloc>>
+    : std::true_type {};
+template <class T, class Alloc, sharing_policy SP>
+struct is_trivially_relocatable<details::shared_compact_ptr<T, Alloc, SP>>
+    : std::true_type {};
+template <class T, class Alloc, sharing_policy SP>
+struct is_trivially_relocatable<details::cow_compact_ptr<T, Alloc, SP>>
+    : std::true_type {};
+template <class T>
+struct is_trivially_relocatable<details::arena_ptr<T>> : std::true_type {};
+
+// The standard smart pointers hold no self-references in any mainstream
+// implementation
+template <class T, class D>
+struct is_trivially_relocatable<std::unique_ptr<T, D>>
+    : is_trivially_relocatable<D> {};
+template <class T>
+struct is_trivially_relocatable<std::shared_ptr<T>> : std::true_type {};
+template <class T>
+struct is_trivially_relocatable<std::weak_ptr<T>> : std::true_type {};
+#endif  // __STDC_HOSTED__
+
 template <class T, class F>
 concept inplace_proxiable_target = proxiable<details::inplace_ptr<T>, F>;
 
@@ -1014,6 +2669,18 @@ proxy<F> make_proxy_inplace(T&& value)
       std::forward<T>(value)};
 }
 
+namespace details { template <class F> struct observer_facade; }
+
+template <class F>
+using proxy_view = proxy<details::observer_facade<F>>;
+
+template <facade F, class T>
+proxy_view<F> make_proxy_view(T& value) noexcept
+    requires(proxiable<details::observer_ptr<T>, details::observer_facade<F>>) {
+  return proxy_view<F>{
+      std::in_place_type<details::observer_ptr<T>>, std::addressof(value)};
+}
+
 #if __STDC_HOSTED__
 template <facade F, class T, class Alloc, class... Args>
 proxy<F> allocate_proxy(const Alloc& alloc, Args&&... args) {
@@ -1041,7 +2708,765 @@ template <facade F, class T>
 proxy<F> make_proxy(T&& value) {
   return details::make_proxy_impl<F, std::decay_t<T>>(std::forward<T>(value));
 }
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class Alloc, class... Args>
+proxy<F> allocate_proxy_shared(const Alloc& alloc, Args&&... args) {
+  return proxy<F>{std::in_place_type<details::shared_compact_ptr<T, Alloc, SP>>,
+      alloc, std::forward<Args>(args)...};
+}
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class Alloc, class U, class... Args>
+proxy<F> allocate_proxy_shared(const Alloc& alloc, std::initializer_list<U> il,
+    Args&&... args) {
+  return proxy<F>{std::in_place_type<details::shared_compact_ptr<T, Alloc, SP>>,
+      alloc, il, std::forward<Args>(args)...};
+}
+template <facade F, sharing_policy SP = sharing_policy::atomic, class Alloc,
+    class T>
+proxy<F> allocate_proxy_shared(const Alloc& alloc, T&& value) {
+  return proxy<F>{std::in_place_type<
+      details::shared_compact_ptr<std::decay_t<T>, Alloc, SP>>,
+      alloc, std::forward<T>(value)};
+}
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class... Args>
+proxy<F> make_proxy_shared(Args&&... args) {
+  return allocate_proxy_shared<F, T, SP>(
+      details::facade_allocator_t<F, T>{}, std::forward<Args>(args)...);
+}
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class U, class... Args>
+proxy<F> make_proxy_shared(std::initializer_list<U> il, Args&&... args) {
+  return allocate_proxy_shared<F, T, SP>(
+      details::facade_allocator_t<F, T>{}, il, std::forward<Args>(args)...);
+}
+template <facade F, sharing_policy SP = sharing_policy::atomic, class T>
+proxy<F> make_proxy_shared(T&& value) {
+  return allocate_proxy_shared<F, SP>(
+      details::facade_allocator_t<F, std::decay_t<T>>{},
+      std::forward<T>(value));
+}
+
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class Alloc, class... Args>
+proxy<F> allocate_proxy_cow(const Alloc& alloc, Args&&... args) {
+  return proxy<F>{std::in_place_type<details::cow_compact_ptr<T, Alloc, SP>>,
+      alloc, std::forward<Args>(args)...};
+}
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class Alloc, class U, class... Args>
+proxy<F> allocate_proxy_cow(const Alloc& alloc, std::initializer_list<U> il,
+    Args&&... args) {
+  return proxy<F>{std::in_place_type<details::cow_compact_ptr<T, Alloc, SP>>,
+      alloc, il, std::forward<Args>(args)...};
+}
+template <facade F, sharing_policy SP = sharing_policy::atomic, class Alloc,
+    class T>
+proxy<F> allocate_proxy_cow(const Alloc& alloc, T&& value) {
+  return proxy<F>{std::in_place_type<
+      details::cow_compact_ptr<std::decay_t<T>, Alloc, SP>>,
+      alloc, std::forward<T>(value)};
+}
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class... Args>
+proxy<F> make_proxy_cow(Args&&... args) {
+  return allocate_proxy_cow<F, T, SP>(
+      details::facade_allocator_t<F, T>{}, std::forward<Args>(args)...);
+}
+template <facade F, class T, sharing_policy SP = sharing_policy::atomic,
+    class U, class... Args>
+proxy<F> make_proxy_cow(std::initializer_list<U> il, Args&&... args) {
+  return allocate_proxy_cow<F, T, SP>(
+      details::facade_allocator_t<F, T>{}, il, std::forward<Args>(args)...);
+}
+template <facade F, sharing_policy SP = sharing_policy::atomic, class T>
+proxy<F> make_proxy_cow(T&& value) {
+  return allocate_proxy_cow<F, SP>(
+      details::facade_allocator_t<F, std::decay_t<T>>{},
+      std::forward<T>(value));
+}
+
+template <facade F, class T, class... Args>
+proxy<F> make_proxy_in(arena& a, Args&&... args) {
+  return proxy<F>{std::in_place_type<details::arena_ptr<T>>,
+      a, std::forward<Args>(args)...};
+}
+template <facade F, class T, class U, class... Args>
+proxy<F> make_proxy_in(arena& a, std::initializer_list<U> il, Args&&... args) {
+  return proxy<F>{std::in_place_type<details::arena_ptr<T>>,
+      a, il, std::forward<Args>(args)...};
+}
+template <facade F, class T>
+proxy<F> make_proxy_in(arena& a, T&& value) {
+  return proxy<F>{std::in_place_type<details::arena_ptr<std::decay_t<T>>>,
+      a, std::forward<T>(value)};
+}
+
+template <class F> requires(details::facade_with_weak<F>)
+class weak_proxy {
+ public:
+  weak_proxy() noexcept : block_(nullptr) {}
+  weak_proxy(const proxy<F>& p) noexcept : block_(nullptr) {
+    if (!p.has_value()) { return; }
+    const details::weak_ops* ops =
+        proxy_reflect<details::weak_reflection>(p).ops;
+    if (ops == nullptr) { return; }
+    meta_ = details::proxy_helper<F>::get_meta_ptr(p);
+    block_ = ops->get_block(details::proxy_helper<F>::get_storage(p));
+    ops->add_weak(block_);
+  }
+  weak_proxy(const weak_proxy& rhs) noexcept
+      : meta_(rhs.meta_), block_(rhs.block_)
+      { if (block_ != nullptr) { get_ops().add_weak(block_); } }
+  weak_proxy(weak_proxy&& rhs) noexcept
+      : meta_(rhs.meta_), block_(std::exchange(rhs.block_, nullptr)) {}
+  ~weak_proxy() { reset(); }
+
+  weak_proxy& operator=(const weak_proxy& rhs) noexcept {
+    if (this != &rhs) { weak_proxy{rhs}.swap(*this); }
+    return *this;
+  }
+  weak_proxy& operator=(weak_proxy&& rhs) noexcept {
+    if (this != &rhs) { weak_proxy{std::move(rhs)}.swap(*this); }
+    return *this;
+  }
+  weak_proxy& operator=(const proxy<F>& p) noexcept {
+    weak_proxy{p}.swap(*this);
+    return *this;
+  }
+
+  void reset() noexcept {
+    if (block_ != nullptr) {
+      get_ops().release_weak(std::exchange(block_, nullptr));
+    }
+  }
+  void swap(weak_proxy& rhs) noexcept {
+    std::swap(meta_, rhs.meta_);
+    std::swap(block_, rhs.block_);
+  }
+  bool expired() const noexcept
+      { return block_ == nullptr || get_ops().expired(block_); }
+  proxy<F> lock() const noexcept {
+    if (block_ == nullptr) { return proxy<F>{}; }
+    return details::proxy_helper<F>::lock(meta_, get_ops().lock, block_);
+  }
+
+  friend void swap(weak_proxy& lhs, weak_proxy& rhs) noexcept { lhs.swap(rhs); }
+
+ private:
+  const details::weak_ops& get_ops() const noexcept {
+    const details::weak_reflection& r = *meta_.operator->();
+    return *r.ops;
+  }
+
+  details::facade_meta_ptr<F> meta_;
+  void* block_;
+};
+
+namespace details {
+
+template <class T, class F>
+concept segment_proxiable = facade<F> && std::is_move_constructible_v<T> &&
+    std::is_nothrow_destructible_v<T> &&
+    has_copyability<inplace_ptr<T>>(F::constraints.copyability) &&
+    has_relocatability<inplace_ptr<T>>(F::constraints.relocatability) &&
+    has_destructibility<inplace_ptr<T>>(F::constraints.destructibility) &&
+    facade_traits<F>::template conv_applicable_ptr<inplace_ptr<T>> &&
+    facade_traits<F>::template refl_applicable_ptr<inplace_ptr<T>> &&
+    facade_traits<F>::template closed_applicable_ptr<inplace_ptr<T>> &&
+    meta_applicable_ptr<F, inplace_ptr<T>>;
+
+template <class T>
+std::byte* segment_allocate(std::size_t n)
+    { return reinterpret_cast<std::byte*>(std::allocator<T>{}.allocate(n)); }
+template <class T>
+void segment_deallocate(std::byte* data, std::size_t n) noexcept
+    { std::allocator<T>{}.deallocate(reinterpret_cast<T*>(data), n); }
+template <class T>
+void segment_relocate(std::byte* dst, std::byte* src, std::size_t n)
+    noexcept(is_trivially_relocatable_v<T> ||
+        std::is_nothrow_move_constructible_v<T>) {
+  if constexpr (is_trivially_relocatable_v<T>) {
+    std::uninitialized_copy_n(src, sizeof(T) * n, dst);
+  } else {
+    T* first = std::launder(reinterpret_cast<T*>(src));
+    if constexpr (std::is_nothrow_move_constructible_v<T> ||
+        !std::is_copy_constructible_v<T>) {
+      std::uninitialized_move_n(first, n, reinterpret_cast<T*>(dst));
+    } else {
+      std::uninitialized_copy_n(first, n, reinterpret_cast<T*>(dst));
+    }
+    std::destroy_n(first, n);
+  }
+}
+template <class T>
+void segment_copy(std::byte* dst, const std::byte* src, std::size_t n) {
+  std::uninitialized_copy_n(std::launder(reinterpret_cast<const T*>(src)), n,
+      reinterpret_cast<T*>(dst));
+}
+template <class T>
+void segment_destroy(std::byte* data, std::size_t n) noexcept
+    { std::destroy_n(std::launder(reinterpret_cast<T*>(data)), n); }
+
+template <class M>
+struct segment_ops {
+  template <class T>
+  constexpr explicit segment_ops(std::in_place_type_t<T>) noexcept
+      : meta(&meta_storage<M, inplace_ptr<T>>), stride(sizeof(T)),
+        allocate(&segment_allocate<T>), deallocate(&segment_deallocate<T>),
+        copy(nullptr), destroy(&segment_destroy<T>) {
+    static_assert(sizeof(inplace_ptr<T>) == sizeof(T));
+    if constexpr (std::is_copy_constructible_v<T>) { copy = &segment_copy<T>; }
+  }
+
+  const M* meta;
+  std::size_t stride;
+  std::byte* (*allocate)(std::size_t n);
+  void (*deallocate)(std::byte* data, std::size_t n) noexcept;
+  void (*copy)(std::byte* dst, const std::byte* src, std::size_t n);
+  void (*destroy)(std::byte* data, std::size_t n) noexcept;
+};
+template <class M, class T>
+inline constexpr segment_ops<M> segment_ops_storage{std::in_place_type<T>};
+
+template <class M>
+struct segment {
+  const segment_ops<M>* ops;
+  std::byte* data;
+  std::size_t size;
+  std::size_t capacity;
+};
+
+}  // namespace details
+
+template <facade F>
+class poly_collection {
+  using _Meta = typename details::facade_traits<F>::meta;
+  using _Segment = details::segment<_Meta>;
+  template <class T>
+  static constexpr const details::segment_ops<_Meta>* _Ops =
+      &details::segment_ops_storage<_Meta, T>;
+
+ public:
+  poly_collection() noexcept = default;
+  poly_collection(const poly_collection& rhs)
+      requires(F::constraints.copyability != constraint_level::none)
+      : poly_collection() {
+    segments_.reserve(rhs.segments_.size());
+    for (const _Segment& s : rhs.segments_) {
+      if (s.size == 0u) { continue; }
+      auto deleter = [&](std::byte* data) { s.ops->deallocate(data, s.size); };
+      std::unique_ptr<std::byte, decltype(deleter)> data{
+          s.ops->allocate(s.size), deleter};
+      s.ops->copy(data.get(), s.data, s.size);
+      segments_.push_back(_Segment{s.ops, data.release(), s.size, s.size});
+    }
+    size_ = rhs.size_;
+  }
+  poly_collection(poly_collection&& rhs) noexcept
+      : segments_(std::move(rhs.segments_)),
+        size_(std::exchange(rhs.size_, 0u)) {}
+  poly_collection& operator=(const poly_collection& rhs)
+      requires(F::constraints.copyability != constraint_level::none) {
+    if (this != &rhs) { *this = poly_collection{rhs}; }
+    return *this;
+  }
+  poly_collection& operator=(poly_collection&& rhs) noexcept {
+    if (this != &rhs) {
+      clear();
+      segments_ = std::move(rhs.segments_);
+      size_ = std::exchange(rhs.size_, 0u);
+    }
+    return *this;
+  }
+  ~poly_collection() { clear(); }
+
+  template <class T, class... Args>
+  T& emplace(Args&&... args) requires(details::segment_proxiable<T, F> &&
+      std::is_constructible_v<T, Args...>) {
+    _Segment& s = get_or_add_segment(_Ops<T>);
+    T* result;
+    if (s.size == s.capacity) {
+      std::size_t capacity = s.capacity == 0u ? 1u : s.capacity * 2u;
+      std::allocator<T> al;
+      auto deleter = [&](T* ptr) { al.deallocate(ptr, capacity); };
+      std::unique_ptr<T, decltype(deleter)> data{
+          al.allocate(capacity), deleter};
+      result = std::construct_at(data.get() + s.size,
+          std::forward<Args>(args)...);
+      if constexpr (std::is_nothrow_move_constructible_v<T>) {
+        details::segment_relocate<T>(
+            reinterpret_cast<std::byte*>(data.get()), s.data, s.size);
+      } else {
+        auto destroyer = [](T* ptr) { std::destroy_at(ptr); };
+        std::unique_ptr<T, decltype(destroyer)> guard{result, destroyer};
+        details::segment_relocate<T>(
+            reinterpret_cast<std::byte*>(data.get()), s.data, s.size);
+        guard.release();
+      }
+      if (s.data != nullptr)
+          { details::segment_deallocate<T>(s.data, s.capacity); }
+      s.data = reinterpret_cast<std::byte*>(data.release());
+      s.capacity = capacity;
+    } else {
+      result = std::construct_at(reinterpret_cast<T*>(s.data) + s.size,
+          std::forward<Args>(args)...);
+    }
+    ++s.size;
+    ++size_;
+    return *result;
+  }
+  template <class T>
+  std::decay_t<T>& insert(T&& value)
+      requires(std::is_constructible_v<std::decay_t<T>, T>)
+      { return emplace<std::decay_t<T>>(std::forward<T>(value)); }
+
+  template <class T>
+  std::span<T> segment() noexcept {
+    const _Segment* s = find_segment(_Ops<T>);
+    if (s == nullptr) { return {}; }
+    return {std::launder(reinterpret_cast<T*>(s->data)), s->size};
+  }
+  template <class T>
+  std::span<const T> segment() const noexcept {
+    const _Segment* s = find_segment(_Ops<T>);
+    if (s == nullptr) { return {}; }
+    return {std::launder(reinterpret_cast<const T*>(s->data)), s->size};
+  }
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0u; }
+  std::size_t segment_count() const noexcept { return segments_.size(); }
+  void clear() noexcept {
+    for (_Segment& s : segments_) {
+      s.ops->destroy(s.data, s.size);
+      if (s.data != nullptr) { s.ops->deallocate(s.data, s.capacity); }
+    }
+    segments_.clear();
+    size_ = 0u;
+  }
+  void swap(poly_collection& rhs) noexcept {
+    segments_.swap(rhs.segments_);
+    std::swap(size_, rhs.size_);
+  }
+
+  template <class C, class O, class... Args>
+  void invoke(Args&&... args)
+      requires(details::overload_traits<O>::qualifier ==
+          details::qualifier_type::lv ||
+          details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv)
+      { invoke_segments<C, O, void>(nullptr, args...); }
+  template <class C, class O, class... Args>
+  void invoke(Args&&... args) const
+      requires(details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv)
+      { invoke_segments<C, O, void>(nullptr, args...); }
+  template <class C, class O, class... Args>
+  void invoke(parallel_t policy, Args&&... args)
+      requires((details::overload_traits<O>::qualifier ==
+          details::qualifier_type::lv ||
+          details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv) &&
+          details::overload_traits<O>::template const_lv_invocable<Args...>)
+      { invoke_segments<C, O, void>(policy, nullptr, args...); }
+  template <class C, class O, class... Args>
+  void invoke(parallel_t policy, Args&&... args) const
+      requires(details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv &&
+          details::overload_traits<O>::template const_lv_invocable<Args...>)
+      { invoke_segments<C, O, void>(policy, nullptr, args...); }
+  template <class C, class O, class... Args>
+  void invoke_into(
+      std::span<typename details::overload_traits<O>::return_type> results,
+      Args&&... args)
+      requires(!std::is_void_v<typename details::overload_traits<O>
+          ::return_type> && (details::overload_traits<O>::qualifier ==
+          details::qualifier_type::lv ||
+          details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv)) {
+    assert(results.size() >= size_);
+    invoke_segments<C, O, typename details::overload_traits<O>::return_type>(
+        results.data(), args...);
+  }
+  template <class C, class O, class... Args>
+  void invoke_into(
+      std::span<typename details::overload_traits<O>::return_type> results,
+      Args&&... args) const
+      requires(!std::is_void_v<typename details::overload_traits<O>
+          ::return_type> && details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv) {
+    assert(results.size() >= size_);
+    invoke_segments<C, O, typename details::overload_traits<O>::return_type>(
+        results.data(), args...);
+  }
+  template <class C, class O, class... Args>
+  void invoke_into(parallel_t policy,
+      std::span<typename details::overload_traits<O>::return_type> results,
+      Args&&... args)
+      requires(!std::is_void_v<typename details::overload_traits<O>
+          ::return_type> && (details::overload_traits<O>::qualifier ==
+          details::qualifier_type::lv ||
+          details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv) &&
+          details::overload_traits<O>::template const_lv_invocable<Args...>) {
+    assert(results.size() >= size_);
+    invoke_segments<C, O, typename details::overload_traits<O>::return_type>(
+        policy, results.data(), args...);
+  }
+  template <class C, class O, class... Args>
+  void invoke_into(parallel_t policy,
+      std::span<typename details::overload_traits<O>::return_type> results,
+      Args&&... args) const
+      requires(!std::is_void_v<typename details::overload_traits<O>
+          ::return_type> && details::overload_traits<O>::qualifier ==
+          details::qualifier_type::const_lv &&
+          details::overload_traits<O>::template const_lv_invocable<Args...>) {
+    assert(results.size() >= size_);
+    invoke_segments<C, O, typename details::overload_traits<O>::return_type>(
+        policy, results.data(), args...);
+  }
+
+  friend void swap(poly_collection& lhs, poly_collection& rhs) noexcept
+      { lhs.swap(rhs); }
+
+ private:
+  const _Segment* find_segment(const details::segment_ops<_Meta>* ops)
+      const noexcept {
+    auto it = std::ranges::lower_bound(segments_, ops,
+        std::less<const details::segment_ops<_Meta>*>{}, &_Segment::ops);
+    return it != segments_.end() && it->ops == ops ? &*it : nullptr;
+  }
+  // Invokes `count` objects of a segment from index `first`, and writes the
+  // results to `results` unless R is void. A bulk convention is invoked once
+  // when the results are not discarded
+  template <class C, class O, class R, class... Args>
+  static void invoke_segment(const _Segment& s, std::size_t first,
+      std::size_t count, details::bulk_results_t<R> results, Args&... args) {
+    using QB = std::conditional_t<details::overload_traits<O>::qualifier ==
+        details::qualifier_type::const_lv, const std::byte, std::byte>;
+    std::size_t stride = s.ops->stride;
+    QB* data = s.data + first * stride;
+    if constexpr (details::bulk_conv<C, O> && std::is_same_v<
+        R, typename details::overload_traits<O>::return_type>) {
+      details::proxy_helper<F>::template get_bulk_dispatcher<C, O>(
+          *s.ops->meta)(data, count, results, args...);
+    } else {
+      auto dispatcher = details::proxy_helper<F>
+          ::template get_dispatcher<C, O>(*s.ops->meta);
+      for (QB* it = data, *last = it + count * stride; it != last;
+          it += stride) {
+        if constexpr (std::is_void_v<R>) {
+          dispatcher(*it, args...);
+        } else {
+          *results++ = dispatcher(*it, args...);
+        }
+      }
+    }
+  }
+  template <class C, class O, class R, class... Args>
+  void invoke_segments(details::bulk_results_t<R> results, Args&... args)
+      const {
+    for (const _Segment& s : segments_) {
+      invoke_segment<C, O, R>(s, 0u, s.size, results, args...);
+      if constexpr (!std::is_void_v<R>) { results += s.size; }
+    }
+  }
+  // Splits the segments into pieces of at most the same size, so that large
+  // segments are shared by several threads
+  template <class C, class O, class R, class... Args>
+  void invoke_segments(parallel_t policy, details::bulk_results_t<R> results,
+      const Args&... args) const {
+    using runner = details::parallel_runner<C>;
+    struct piece {
+      const _Segment* segment;
+      std::size_t first;
+      std::size_t count;
+      std::size_t offset;
+    };
+    std::size_t thread_count = runner::thread_count(policy);
+    std::size_t chunk_count =
+        thread_count * details::parallel_chunks_per_thread;
+    std::size_t step = (size_ + chunk_count - 1u) / chunk_count;
+    std::vector<piece> pieces;
+    std::size_t offset = 0u;
+    for (const _Segment& s : segments_) {
+      for (std::size_t first = 0u; first < s.size; first += step) {
+        pieces.push_back(piece{&s, first,
+            s.size - first < step ? s.size - first : step, offset + first});
+      }
+      offset += s.size;
+    }
+    runner::run(thread_count, pieces.size(), [&](std::size_t i) {
+      const piece& p = pieces[i];
+      if constexpr (std::is_void_v<R>) {
+        invoke_segment<C, O, R>(*p.segment, p.first, p.count, nullptr,
+            args...);
+      } else {
+        invoke_segment<C, O, R>(*p.segment, p.first, p.count,
+            results + p.offset, args...);
+      }
+    });
+  }
+  _Segment& get_or_add_segment(const details::segment_ops<_Meta>* ops) {
+    auto it = std::ranges::lower_bound(segments_, ops,
+        std::less<const details::segment_ops<_Meta>*>{}, &_Segment::ops);
+    if (it == segments_.end() || it->ops != ops)
+        { it = segments_.insert(it, _Segment{ops, nullptr, 0u, 0u}); }
+    return *it;
+  }
+
+  std::vector<_Segment> segments_;
+  std::size_t size_ = 0u;
+};
+
+template <facade F>
+    requires((F::constraints.relocatability >= constraint_level::nothrow ||
+        F::constraints.copyability == constraint_level::trivial) &&
+        F::constraints.destructibility >= constraint_level::nothrow)
+class proxy_vector {
+  using _Helper = details::proxy_helper<F>;
+
+ public:
+  using value_type = proxy<F>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using reference = proxy<F>&;
+  using const_reference = const proxy<F>&;
+  using pointer = proxy<F>*;
+  using const_pointer = const proxy<F>*;
+  using iterator = proxy<F>*;
+  using const_iterator = const proxy<F>*;
+
+  proxy_vector() noexcept = default;
+  proxy_vector(const proxy_vector& rhs)
+      requires(F::constraints.copyability != constraint_level::none)
+      : proxy_vector() {
+    if (rhs.size_ == 0u) { return; }
+    data_ = allocate(rhs.size_);
+    capacity_ = rhs.size_;
+    std::uninitialized_copy_n(rhs.data_, rhs.size_, data_);
+    size_ = rhs.size_;
+  }
+  proxy_vector(proxy_vector&& rhs) noexcept
+      : data_(std::exchange(rhs.data_, nullptr)),
+        size_(std::exchange(rhs.size_, 0u)),
+        capacity_(std::exchange(rhs.capacity_, 0u)) {}
+  proxy_vector& operator=(const proxy_vector& rhs)
+      requires(F::constraints.copyability != constraint_level::none) {
+    if (this != &rhs) { *this = proxy_vector{rhs}; }
+    return *this;
+  }
+  proxy_vector& operator=(proxy_vector&& rhs) noexcept {
+    if (this != &rhs) {
+      release();
+      data_ = std::exchange(rhs.data_, nullptr);
+      size_ = std::exchange(rhs.size_, 0u);
+      capacity_ = std::exchange(rhs.capacity_, 0u);
+    }
+    return *this;
+  }
+  ~proxy_vector() { release(); }
+
+  iterator begin() noexcept { return data_; }
+  const_iterator begin() const noexcept { return data_; }
+  const_iterator cbegin() const noexcept { return data_; }
+  iterator end() noexcept { return data_ + size_; }
+  const_iterator end() const noexcept { return data_ + size_; }
+  const_iterator cend() const noexcept { return data_ + size_; }
+  pointer data() noexcept { return data_; }
+  const_pointer data() const noexcept { return data_; }
+  reference operator[](size_type pos) noexcept
+      { assert(pos < size_); return data_[pos]; }
+  const_reference operator[](size_type pos) const noexcept
+      { assert(pos < size_); return data_[pos]; }
+  reference front() noexcept { assert(size_ > 0u); return data_[0u]; }
+  const_reference front() const noexcept
+      { assert(size_ > 0u); return data_[0u]; }
+  reference back() noexcept { assert(size_ > 0u); return data_[size_ - 1u]; }
+  const_reference back() const noexcept
+      { assert(size_ > 0u); return data_[size_ - 1u]; }
+  size_type size() const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  bool empty() const noexcept { return size_ == 0u; }
+
+  void reserve(size_type capacity) {
+    if (capacity <= capacity_) { return; }
+    proxy<F>* data = allocate(capacity);
+    _Helper::relocate(data, data_, size_);
+    deallocate(data_, capacity_);
+    data_ = data;
+    capacity_ = capacity;
+  }
+  void shrink_to_fit() {
+    if (size_ == capacity_) { return; }
+    proxy<F>* data = size_ == 0u ? nullptr : allocate(size_);
+    _Helper::relocate(data, data_, size_);
+    deallocate(data_, capacity_);
+    data_ = data;
+    capacity_ = size_;
+  }
+  void clear() noexcept {
+    destroy_range(data_, data_ + size_);
+    size_ = 0u;
+  }
+  template <class... Args>
+  reference emplace_back(Args&&... args)
+      requires(std::is_constructible_v<proxy<F>, Args...>)
+      { return *emplace(end(), std::forward<Args>(args)...); }
+  void push_back(const proxy<F>& value)
+      requires(F::constraints.copyability != constraint_level::none)
+      { emplace_back(value); }
+  void push_back(proxy<F>&& value) { emplace_back(std::move(value)); }
+  void pop_back() noexcept {
+    assert(size_ > 0u);
+    --size_;
+    destroy_range(data_ + size_, data_ + size_ + 1u);
+  }
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args)
+      requires(std::is_constructible_v<proxy<F>, Args...>) {
+    size_type index = pos - data_;
+    assert(index <= size_);
+    if (size_ == capacity_) {
+      size_type capacity = capacity_ == 0u ? 1u : capacity_ * 2u;
+      auto deleter = [&](proxy<F>* ptr) { deallocate(ptr, capacity); };
+      std::unique_ptr<proxy<F>, decltype(deleter)> data{
+          allocate(capacity), deleter};
+      std::construct_at(data.get() + index, std::forward<Args>(args)...);
+      _Helper::relocate(data.get(), data_, index);
+      _Helper::relocate(data.get() + index + 1u, data_ + index, size_ - index);
+      deallocate(data_, capacity_);
+      data_ = data.release();
+      capacity_ = capacity;
+    } else if (index == size_) {
+      std::construct_at(data_ + index, std::forward<Args>(args)...);
+    } else {
+      proxy<F> value(std::forward<Args>(args)...);
+      _Helper::relocate(data_ + index + 1u, data_ + index, size_ - index);
+      std::construct_at(data_ + index, std::move(value));
+    }
+    ++size_;
+    return data_ + index;
+  }
+  iterator insert(const_iterator pos, const proxy<F>& value)
+      requires(F::constraints.copyability != constraint_level::none)
+      { return emplace(pos, value); }
+  iterator insert(const_iterator pos, proxy<F>&& value)
+      { return emplace(pos, std::move(value)); }
+  iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    proxy<F>* begin = data_ + (first - data_);
+    if (first == last) { return begin; }
+    size_type count = last - first;
+    destroy_range(begin, begin + count);
+    _Helper::relocate(begin, begin + count, size_ - (last - data_));
+    size_ -= count;
+    return begin;
+  }
+  void swap(proxy_vector& rhs) noexcept {
+    std::swap(data_, rhs.data_);
+    std::swap(size_, rhs.size_);
+    std::swap(capacity_, rhs.capacity_);
+  }
+
+  friend void swap(proxy_vector& lhs, proxy_vector& rhs) noexcept
+      { lhs.swap(rhs); }
+
+ private:
+  static proxy<F>* allocate(size_type n)
+      { return std::allocator<proxy<F>>{}.allocate(n); }
+  static void deallocate(proxy<F>* data, size_type n) noexcept {
+    if (data != nullptr) { std::allocator<proxy<F>>{}.deallocate(data, n); }
+  }
+  void release() noexcept {
+    clear();
+    deallocate(data_, capacity_);
+    data_ = nullptr;
+    capacity_ = 0u;
+  }
+
+  proxy<F>* data_ = nullptr;
+  size_type size_ = 0u;
+  size_type capacity_ = 0u;
+};
+#endif  // __STDC_HOSTED__
+
+namespace details {
+
+template <class P, class F>
+using visit_candidate_t =
+    std::conditional_t<proxiable<P, F>, std::tuple<P>, std::tuple<>>;
+template <class F, class T>
+using visit_candidates_t = decltype(std::tuple_cat(
+    std::declval<visit_candidate_t<inplace_ptr<T>, F>>()
+#if __STDC_HOSTED__
+    , std::declval<visit_candidate_t<allocated_ptr<T, std::allocator<T>>, F>>(),
+    std::declval<visit_candidate_t<compact_ptr<T, std::allocator<T>>, F>>()
 #endif  // __STDC_HOSTED__
+    ));
+
+template <class F, qualifier_type Q, class R, class V, class FB>
+R visit_impl(add_qualifier_t<proxy<F>, Q> p, V&, FB& fallback,
+    std::tuple<>*) {
+  if constexpr (std::is_void_v<R>) {
+    fallback(std::forward<add_qualifier_t<proxy<F>, Q>>(p));
+  } else {
+    return fallback(std::forward<add_qualifier_t<proxy<F>, Q>>(p));
+  }
+}
+template <class F, qualifier_type Q, class R, class V, class FB, class P,
+    class... Ps>
+R visit_impl(add_qualifier_t<proxy<F>, Q> p, V& visitor, FB& fallback,
+    std::tuple<P, Ps...>*) {
+  if (proxy_helper<F>::template is<P>(p)) {
+    if constexpr (std::is_void_v<R>) {
+      visitor(*proxy_helper<F>::template get_ptr<P, Q>(
+          std::forward<add_qualifier_t<proxy<F>, Q>>(p)));
+      return;
+    } else {
+      return visitor(*proxy_helper<F>::template get_ptr<P, Q>(
+          std::forward<add_qualifier_t<proxy<F>, Q>>(p)));
+    }
+  }
+  return visit_impl<F, Q, R>(std::forward<add_qualifier_t<proxy<F>, Q>>(p),
+      visitor, fallback, static_cast<std::tuple<Ps...>*>(nullptr));
+}
+template <class F, qualifier_type Q, class... Ts, class V, class FB>
+decltype(auto) visit(add_qualifier_t<proxy<F>, Q> p, V& visitor,
+    FB& fallback) {
+  using R = std::invoke_result_t<FB&, add_qualifier_t<proxy<F>, Q>>;
+  using Ps = decltype(std::tuple_cat(
+      std::declval<visit_candidates_t<F, Ts>>()...));
+  return visit_impl<F, Q, R>(std::forward<add_qualifier_t<proxy<F>, Q>>(p),
+      visitor, fallback, static_cast<Ps*>(nullptr));
+}
+
+}  // namespace details
+
+template <class... Ts, class F, class V, class FB>
+    requires(details::type_identifying_facade<F>)
+decltype(auto) proxy_visit(proxy<F>& p, V&& visitor, FB&& fallback) {
+  return details::visit<F, details::qualifier_type::lv, Ts...>(
+      p, visitor, fallback);
+}
+template <class... Ts, class F, class V, class FB>
+    requires(details::type_identifying_facade<F>)
+decltype(auto) proxy_visit(const proxy<F>& p, V&& visitor, FB&& fallback) {
+  return details::visit<F, details::qualifier_type::const_lv, Ts...>(
+      p, visitor, fallback);
+}
+template <class... Ts, class F, class V, class FB>
+    requires(details::type_identifying_facade<F>)
+decltype(auto) proxy_visit(proxy<F>&& p, V&& visitor, FB&& fallback) {
+  return details::visit<F, details::qualifier_type::rv, Ts...>(
+      std::move(p), visitor, fallback);
+}
+template <class... Ts, class F, class V, class FB>
+    requires(details::type_identifying_facade<F>)
+decltype(auto) proxy_visit(const proxy<F>&& p, V&& visitor, FB&& fallback) {
+  return details::visit<F, details::qualifier_type::const_rv, Ts...>(
+      std::move(p), visitor, fallback);
+}
 
 #define ___PRO_DIRECT_FUNC_IMPL(...) \
     noexcept(noexcept(__VA_ARGS__)) requires(requires { __VA_ARGS__; }) \
@@ -1119,6 +3544,18 @@ consteval auto make_restricted_layout(proxiable_ptr_constraints value,
   if (value.max_align > max_align) { value.max_align = max_align; }
   return value;
 }
+consteval auto make_expanded_layout(proxiable_ptr_constraints value,
+    std::size_t max_size, std::size_t max_align) {
+  if (value.max_size == invalid_size)
+      { value.max_size = sizeof(ptr_prototype); }
+  if (value.max_align == invalid_size)
+      { value.max_align = alignof(ptr_prototype); }
+  if (value.max_size < max_size) { value.max_size = max_size; }
+  if (value.max_align < max_align) { value.max_align = max_align; }
+  value.max_size = (value.max_size + value.max_align - 1u) /
+      value.max_align * value.max_align;
+  return value;
+}
 consteval auto make_copyable(proxiable_ptr_constraints value,
     constraint_level cl) {
   if (value.copyability < cl) { value.copyability = cl; }
@@ -1146,6 +3583,37 @@ consteval std::size_t max_align_of(std::size_t value) {
   value &= ~value + 1u;
   return value < alignof(std::max_align_t) ? value : alignof(std::max_align_t);
 }
+consteval auto make_closed_layout(proxiable_ptr_constraints value,
+    std::type_identity<void>) { return value; }
+// Only a layout that is not specified is fitted to the types. A specified one
+// is kept, and the facade is ill-formed if a type does not fit in it
+template <class... Ts>
+consteval auto make_closed_layout(proxiable_ptr_constraints value,
+    std::type_identity<std::tuple<Ts...>>) {
+  if (value.max_align == invalid_size) {
+    value.max_align = 1u;
+    for (std::size_t align : {alignof(Ts)...}) {
+      if (value.max_align < align) { value.max_align = align; }
+    }
+  }
+  if (value.max_size == invalid_size) {
+    value.max_size = 0u;
+    for (std::size_t size : {sizeof(Ts)...}) {
+      if (value.max_size < size) { value.max_size = size; }
+    }
+    value.max_size = (value.max_size + value.max_align - 1u) /
+        value.max_align * value.max_align;
+  }
+  return value;
+}
+consteval bool is_closed_layout_fitting(proxiable_ptr_constraints,
+    std::type_identity<void>) { return true; }
+template <class... Ts>
+consteval bool is_closed_layout_fitting(proxiable_ptr_constraints value,
+    std::type_identity<std::tuple<Ts...>>) {
+  return ((sizeof(Ts) <= value.max_size && alignof(Ts) <= value.max_align) &&
+      ...);
+}
 
 template <bool IS_DIRECT, class D, class... Os>
 struct conv_impl {
@@ -1155,10 +3623,20 @@ struct conv_impl {
   template <class F>
   using accessor = typename D::template accessor<F, conv_impl, Os...>;
 };
-template <class Cs, class Rs, proxiable_ptr_constraints C>
+template <bool IS_DIRECT, class D, class... Os>
+struct hot_conv_impl : conv_impl<IS_DIRECT, D, Os...>
+    { static constexpr bool is_hot = true; };
+template <class Cs, class Rs, proxiable_ptr_constraints C, class Ts, class A,
+    class M, class B>
 struct facade_impl {
+  static_assert(is_closed_layout_fitting(C, std::type_identity<Ts>{}));
+
   using convention_types = Cs;
   using reflection_types = Rs;
+  using restricted_types = Ts;
+  using allocator_type = A;
+  using meta_layout = M;
+  using base_facade = B;
   static constexpr proxiable_ptr_constraints constraints = C;
 };
 
@@ -1196,12 +3674,16 @@ using merge_tuple_impl_t = recursive_reduction_t<add_tuple_t, O, Is...>;
 template <class T, class U>
 using merge_tuple_t = instantiated_t<merge_tuple_impl_t, U, T>;
 
-template <bool IS_DIRECT, class D>
+template <bool IS_DIRECT, bool IS_HOT, class D>
 struct merge_conv_traits
     { template <class... Os> using type = conv_impl<IS_DIRECT, D, Os...>; };
+template <bool IS_DIRECT, class D>
+struct merge_conv_traits<IS_DIRECT, true, D>
+    { template <class... Os> using type = hot_conv_impl<IS_DIRECT, D, Os...>; };
 template <class C0, class C1>
 using merge_conv_t = instantiated_t<
-    merge_conv_traits<C0::is_direct, typename C0::dispatch_type>::template type,
+    merge_conv_traits<C0::is_direct, is_conv_hot<C0>() || is_conv_hot<C1>(),
+        typename C0::dispatch_type>::template type,
     merge_tuple_t<typename C0::overload_types, typename C1::overload_types>>;
 
 template <class Cs0, class C1, class C> struct add_conv_reduction;
@@ -1220,6 +3702,91 @@ struct add_conv_reduction<std::tuple<Cs...>, std::tuple<>, C>
 template <class Cs, class C>
 using add_conv_t = typename add_conv_reduction<std::tuple<>, Cs, C>::type;
 
+// A view refers to an object it does not own, so it only keeps the lvalue
+// overloads of the indirect conventions, and the reflection of typeid
+template <class Os, class O>
+using add_observer_overload_t = std::conditional_t<
+    overload_traits<O>::qualifier == qualifier_type::lv ||
+        overload_traits<O>::qualifier == qualifier_type::const_lv,
+    add_tuple_t<Os, O>, Os>;
+template <class... Os>
+using observer_overloads_t =
+    recursive_reduction_t<add_observer_overload_t, std::tuple<>, Os...>;
+template <class Cs, class C>
+struct add_observer_conv_reduction : std::type_identity<Cs> {};
+template <class Cs, class C> requires(!C::is_direct)
+struct add_observer_conv_reduction<Cs, C> {
+  using overload_types =
+      instantiated_t<observer_overloads_t, typename C::overload_types>;
+  using type = std::conditional_t<std::tuple_size_v<overload_types> == 0u, Cs,
+      add_tuple_t<Cs, instantiated_t<merge_conv_traits<false, is_conv_hot<C>(),
+          typename C::dispatch_type>::template type, overload_types>>>;
+};
+template <class Cs, class C>
+using add_observer_conv_t = typename add_observer_conv_reduction<Cs, C>::type;
+template <class... Cs>
+using observer_convs_t =
+    recursive_reduction_t<add_observer_conv_t, std::tuple<>, Cs...>;
+template <class Rs, class R>
+using add_observer_refl_t = std::conditional_t<
+    std::is_same_v<R, typeid_reflection>, add_tuple_t<Rs, R>, Rs>;
+template <class... Rs>
+using observer_refls_t =
+    recursive_reduction_t<add_observer_refl_t, std::tuple<>, Rs...>;
+template <class F>
+struct observer_base_traits : std::type_identity<void> {};
+template <class F> requires(requires { typename F::base_facade; } &&
+    !std::is_void_v<typename F::base_facade>)
+struct observer_base_traits<F>
+    : std::type_identity<observer_facade<typename F::base_facade>> {};
+template <class F>
+struct observer_layout_traits : std::type_identity<void> {};
+template <class F> requires(requires { typename F::meta_layout; } &&
+    !std::is_same_v<typename F::meta_layout, embedded_meta_layout>)
+struct observer_layout_traits<F>
+    : std::type_identity<typename F::meta_layout> {};
+// A view of F is laid out like F, so that a view of a facade extending F can
+// also be used as a view of F. An embedded meta is not inherited, since a view
+// does not own the block holding the header
+template <class F>
+struct observer_facade {
+  using convention_types =
+      instantiated_t<observer_convs_t, typename F::convention_types>;
+  using reflection_types =
+      instantiated_t<observer_refls_t, typename F::reflection_types>;
+  using meta_layout = typename observer_layout_traits<F>::type;
+  using base_facade = typename observer_base_traits<F>::type;
+  static constexpr proxiable_ptr_constraints constraints{
+      .max_size = sizeof(void*),
+      .max_align = alignof(void*),
+      .copyability = constraint_level::trivial,
+      .relocatability = constraint_level::trivial,
+      .destructibility = constraint_level::trivial};
+};
+
+#define ___PRO_DEF_VIEW_CONVERSION_ACCESSOR(Q, SELF, ...) \
+    template <class F2, class C> \
+    struct accessor<F2, C, proxy_view<F>() Q> { \
+      __VA_ARGS__ () Q { \
+        if (access_proxy<F2>(SELF).has_value()) { \
+          return proxy_invoke<C, proxy_view<F>() Q>(access_proxy<F2>(SELF)); \
+        } \
+        return nullptr; \
+      } \
+    }
+template <class F>
+struct view_conversion_dispatch {
+  template <class P>
+  proxy_view<F> operator()(P& self) noexcept(noexcept(*self))
+      requires(proxiable<observer_ptr<ptr_element_t<P>>, observer_facade<F>>) {
+    return proxy_view<F>{std::in_place_type<observer_ptr<ptr_element_t<P>>>,
+        std::addressof(*self)};
+  }
+  ___PRO_DEF_MEM_ACCESSOR_TEMPLATE(
+      ___PRO_DEF_VIEW_CONVERSION_ACCESSOR, operator proxy_view<F>)
+};
+#undef ___PRO_DEF_VIEW_CONVERSION_ACCESSOR
+
 template <class F, constraint_level CL>
 using copy_conversion_overload =
     proxy<F>() const& noexcept(CL >= constraint_level::nothrow);
@@ -1266,45 +3833,94 @@ sign(const char (&str)[N]) -> sign<N>;
 
 }  // namespace details
 
-template <class Cs, class Rs, proxiable_ptr_constraints C>
+template <class Cs, class Rs, proxiable_ptr_constraints C, class Ts = void,
+    class A = void, class M = void, class B = void>
 struct basic_facade_builder {
   template <class D, class... Os>
       requires(sizeof...(Os) > 0u &&
           (details::overload_traits<Os>::applicable && ...))
   using add_indirect_convention = basic_facade_builder<details::add_conv_t<
-      Cs, details::conv_impl<false, D, Os...>>, Rs, C>;
+      Cs, details::conv_impl<false, D, Os...>>, Rs, C, Ts, A, M, B>;
   template <class D, class... Os>
       requires(sizeof...(Os) > 0u &&
           (details::overload_traits<Os>::applicable && ...))
   using add_direct_convention = basic_facade_builder<details::add_conv_t<
-      Cs, details::conv_impl<true, D, Os...>>, Rs, C>;
+      Cs, details::conv_impl<true, D, Os...>>, Rs, C, Ts, A, M, B>;
   template <class D, class... Os>
       requires(sizeof...(Os) > 0u &&
           (details::overload_traits<Os>::applicable && ...))
   using add_convention = add_indirect_convention<D, Os...>;
+  template <class D, class... Os>
+      requires(sizeof...(Os) > 0u &&
+          (details::overload_traits<Os>::applicable && ...))
+  using add_hot_convention = basic_facade_builder<details::add_conv_t<
+      Cs, details::hot_conv_impl<false, D, Os...>>, Rs, C, Ts, A, M, B>;
+#if __STDC_HOSTED__
+  template <class D, class... Os>
+      requires(sizeof...(Os) > 0u && std::is_class_v<D> &&
+          !std::is_final_v<D> && (details::overload_traits<Os>::applicable &&
+              ...) && (details::overload_traits<Os>::bulk_applicable && ...))
+  using add_bulk_convention = basic_facade_builder<details::add_conv_t<
+      Cs, details::conv_impl<false, details::bulk_dispatch<D>, Os...>>,
+      Rs, C, Ts, A, M, B>;
+#endif  // __STDC_HOSTED__
   template <class R>
   using add_reflection = basic_facade_builder<
-      Cs, details::add_tuple_t<Rs, R>, C>;
+      Cs, details::add_tuple_t<Rs, R>, C, Ts, A, M, B>;
   template <facade F, bool WithUpwardConversion = false>
   using add_facade = basic_facade_builder<
       details::merge_facade_conv_t<Cs, F, WithUpwardConversion>,
       details::merge_tuple_t<Rs, typename F::reflection_types>,
-      details::merge_constraints(C, F::constraints)>;
+      details::merge_constraints(C, F::constraints), Ts, A, M,
+      std::conditional_t<std::is_void_v<B>, F, B>>;
+  template <class F>
+  using add_view = basic_facade_builder<details::add_conv_t<Cs,
+      details::conv_impl<true, details::view_conversion_dispatch<F>,
+          proxy_view<F>() &>>, Rs, C, Ts, A, M, B>;
   template <std::size_t PtrSize,
       std::size_t PtrAlign = details::max_align_of(PtrSize)>
       requires(std::has_single_bit(PtrAlign) && PtrSize % PtrAlign == 0u)
-  using restrict_layout = basic_facade_builder<
-      Cs, Rs, details::make_restricted_layout(C, PtrSize, PtrAlign)>;
+  using restrict_layout = basic_facade_builder<Cs, Rs,
+      details::make_restricted_layout(C, PtrSize, PtrAlign), Ts, A, M, B>;
+  template <std::size_t PtrSize, std::size_t PtrAlign = alignof(void*)>
+      requires(std::has_single_bit(PtrAlign))
+  using expand_layout = basic_facade_builder<Cs, Rs,
+      details::make_expanded_layout(C, PtrSize, PtrAlign), Ts, A, M, B>;
   template <constraint_level CL>
   using support_copy = basic_facade_builder<
-      Cs, Rs, details::make_copyable(C, CL)>;
+      Cs, Rs, details::make_copyable(C, CL), Ts, A, M, B>;
   template <constraint_level CL>
   using support_relocation = basic_facade_builder<
-      Cs, Rs, details::make_relocatable(C, CL)>;
+      Cs, Rs, details::make_relocatable(C, CL), Ts, A, M, B>;
   template <constraint_level CL>
   using support_destruction = basic_facade_builder<
-      Cs, Rs, details::make_destructible(C, CL)>;
-  using build = details::facade_impl<Cs, Rs, details::normalize(C)>;
+      Cs, Rs, details::make_destructible(C, CL), Ts, A, M, B>;
+  using support_typeid = add_reflection<details::typeid_reflection>;
+#if __STDC_HOSTED__
+  using support_weak = add_reflection<details::weak_reflection>;
+#endif  // __STDC_HOSTED__
+  template <class... Us>
+      requires(sizeof...(Us) > 0u &&
+          ((std::is_object_v<Us> && std::is_same_v<Us, std::decay_t<Us>>) &&
+              ...))
+  using restrict_types = basic_facade_builder<Cs, Rs, C,
+      details::merge_tuple_t<std::tuple<>, std::tuple<Us...>>, A, M, B>;
+  template <class Alloc>
+      requires(std::is_same_v<Alloc, std::remove_cvref_t<Alloc>>)
+  using support_allocator = basic_facade_builder<Cs, Rs, C, Ts, Alloc, M, B>;
+  template <std::size_t N>
+  using support_inline_meta = basic_facade_builder<
+      Cs, Rs, C, Ts, A, details::inline_meta_layout<N>, B>;
+#if __STDC_HOSTED__
+  using support_indexed_meta = basic_facade_builder<
+      Cs, Rs, C, Ts, A, details::indexed_meta_layout, B>;
+  using support_embedded_meta = basic_facade_builder<Cs, Rs,
+      details::make_relocatable(details::make_restricted_layout(C,
+          sizeof(void*), alignof(void*)), constraint_level::trivial),
+      Ts, A, details::embedded_meta_layout, B>;
+#endif  // __STDC_HOSTED__
+  using build = details::facade_impl<Cs, Rs, details::normalize(
+      details::make_closed_layout(C, std::type_identity<Ts>{})), Ts, A, M, B>;
   basic_facade_builder() = delete;
 };
 
@@ -1607,6 +4223,14 @@ struct conversion_dispatch {
 
 }  // namespace pro
 
+#if __STDC_HOSTED__
+template <>
+struct std::hash<pro::type_id> {
+  std::size_t operator()(const pro::type_id& id) const noexcept
+      { return id.hash_code(); }
+};
+#endif  // __STDC_HOSTED__
+
 #undef ___PRO_NO_UNIQUE_ADDRESS_ATTRIBUTE
 
 #endif  // _MSFT_PROXY_
@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from allocate_proxy_cow.md.
+
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemAt, at);
+
+struct Sequence : pro::facade_builder
+    ::add_convention<MemAt, int&(std::size_t), const int&(std::size_t) const>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::build {};
+
+int main() {
+  std::pmr::unsynchronized_pool_resource pool;
+  std::pmr::polymorphic_allocator<> alloc{&pool};
+  pro::proxy<Sequence> p1 = pro::allocate_proxy_cow<Sequence, std::vector<int>>(alloc, {1, 2, 3});
+  pro::proxy<Sequence> p2 = p1;  // Shares the vector
+  p2->at(1) = 20;  // Copies the vector before modifying it
+  std::cout << p1->at(1) << "\n";  // Prints: "2"
+  std::cout << p2->at(1) << "\n";  // Prints: "20"
+}
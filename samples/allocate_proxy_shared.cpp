@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from allocate_proxy_shared.md.
+
+#include <iostream>
+#include <memory_resource>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemAt, at);
+
+struct Sequence : pro::facade_builder
+    ::add_convention<MemAt, int&(std::size_t)>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::build {};
+
+int main() {
+  std::pmr::unsynchronized_pool_resource pool;
+  std::pmr::polymorphic_allocator<> alloc{&pool};
+  pro::proxy<Sequence> p1 = pro::allocate_proxy_shared<Sequence, std::vector<int>>(alloc, {1, 2, 3});
+  pro::proxy<Sequence> p2 = p1;
+  p2->at(1) = 20;
+  std::cout << p1->at(1) << "\n";  // Prints: "20"
+}
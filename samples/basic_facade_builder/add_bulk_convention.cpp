@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from add_bulk_convention.md.
+
+#include <iostream>
+#include <span>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_FREE_DISPATCH(FreeEnergy, Energy);
+
+struct Particle : pro::facade_builder
+    ::add_bulk_convention<FreeEnergy, float() const>
+    ::build {};
+
+struct Dust {
+  float mass, speed;
+};
+
+float Energy(const Dust& d) { return d.mass * d.speed * d.speed / 2; }
+
+// Called once for all the Dust objects in a poly_collection
+void Energy(std::span<const Dust> ds, std::span<float> results) {
+  for (std::size_t i = 0; i < ds.size(); ++i) { results[i] = Energy(ds[i]); }
+}
+
+struct Rock {
+  float mass;
+};
+
+float Energy(const Rock&) { return 0.0f; }  // No bulk overload
+
+int main() {
+  pro::poly_collection<Particle> particles;
+  particles.emplace<Dust>(2.0f, 1.0f);
+  particles.emplace<Rock>(100.0f);
+  particles.emplace<Dust>(2.0f, 3.0f);
+
+  std::vector<float> energies(particles.size());
+  using C = std::tuple_element_t<0u, Particle::convention_types>;
+  particles.invoke_into<C, float() const>(energies);
+  float total = 0.0f;
+  for (float e : energies) { total += e; }
+  std::cout << total << "\n";  // Prints "10"
+
+  pro::proxy<Particle> p = pro::make_proxy<Particle, Dust>(1.0f, 2.0f);
+  std::cout << Energy(*p) << "\n";  // Prints "2"
+}
@@ -0,0 +1,32 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from add_hot_convention.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+PRO_DEF_MEM_DISPATCH(MemName, Name);
+PRO_DEF_MEM_DISPATCH(MemScale, Scale);
+
+struct Shape : pro::facade_builder
+    ::add_convention<MemName, std::string() const>
+    ::add_convention<MemScale, void(double)>
+    ::add_hot_convention<MemArea, double() const>
+    ::build {};
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+  std::string Name() const { return "square"; }
+  void Scale(double factor) noexcept { side *= factor; }
+
+  double side;
+};
+
+int main() {
+  pro::proxy<Shape> p = pro::make_proxy<Shape, Square>(2.0);
+  p->Scale(1.5);
+  std::cout << p->Name() << ": " << p->Area() << "\n";  // Prints "square: 9"
+}
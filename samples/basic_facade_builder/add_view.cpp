@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from add_view.md.
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemDraw, Draw);
+PRO_DEF_MEM_DISPATCH(MemMove, Move);
+
+struct Drawable : pro::facade_builder
+    ::add_convention<MemDraw, void(std::ostream&) const>
+    ::add_convention<MemMove, void(int)>
+    ::add_view<Drawable>
+    ::build {};
+
+struct Point {
+  void Draw(std::ostream& out) const { out << "Point(" << x << ")"; }
+  void Move(int dx) { x += dx; }
+
+  int x;
+};
+
+void MoveAndDraw(pro::proxy_view<Drawable> d) {
+  d->Move(2);
+  d->Draw(std::cout);
+  std::cout << "\n";
+}
+
+int main() {
+  pro::proxy<Drawable> p = pro::make_proxy<Drawable>(Point{1});
+  MoveAndDraw(p);  // Prints: "Point(3)"
+  MoveAndDraw(p);  // Prints: "Point(5)"
+}
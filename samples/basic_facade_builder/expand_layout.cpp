@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from expand_layout.md.
+
+#include <array>
+#include <iostream>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Container : pro::facade_builder
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::build {};
+
+struct InlineContainer : pro::facade_builder
+    ::add_facade<Container>
+    ::expand_layout<4u * sizeof(void*)>
+    ::build {};
+
+int main() {
+  using Array = std::array<void*, 4>;
+  static_assert(!pro::inplace_proxiable_target<Array, Container>);
+  static_assert(pro::inplace_proxiable_target<Array, InlineContainer>);
+  pro::proxy<InlineContainer> p = pro::make_proxy<InlineContainer, Array>();  // No allocation
+  std::cout << p->size() << "\n";  // Prints: "4"
+}
@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from restrict_types.md.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+
+  double side;
+};
+
+struct Rectangle {
+  double Area() const noexcept { return width * height; }
+
+  double width;
+  double height;
+};
+
+struct Shape : pro::facade_builder
+    ::add_convention<MemArea, double() const>
+    ::restrict_types<Square, Rectangle>
+    ::build {};
+
+int main() {
+  static_assert(sizeof(pro::proxy<Shape>) == 3 * sizeof(double));
+  static_assert(!pro::proxiable<Square*, Shape>);
+
+  std::vector<pro::proxy<Shape>> shapes;
+  shapes.push_back(pro::make_proxy<Shape, Square>(2.0));
+  shapes.push_back(pro::make_proxy<Shape, Rectangle>(2.0, 3.0));
+  double total = 0.0;
+  for (auto& shape : shapes) {
+    total += shape->Area();  // Dispatched with a switch on the type index
+  }
+  std::cout << total << "\n";  // Prints: "10"
+}
@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from support_allocator.md.
+
+#include <array>
+#include <iostream>
+#include <memory_resource>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Sized : pro::facade_builder
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::support_allocator<std::pmr::polymorphic_allocator<>>
+    ::build {};
+
+int main() {
+  std::pmr::monotonic_buffer_resource pool;
+  std::pmr::memory_resource* previous = std::pmr::set_default_resource(&pool);
+
+  // std::array<int, 100> is too large to be stored inplace, thus it is
+  // allocated with std::pmr::polymorphic_allocator, which uses `pool`
+  pro::proxy<Sized> p = pro::make_proxy<Sized, std::array<int, 100>>();
+  std::cout << p->size() << "\n";  // Prints: "100"
+
+  p.reset();
+  std::pmr::set_default_resource(previous);
+}
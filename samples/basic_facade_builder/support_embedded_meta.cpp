@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from support_embedded_meta.md.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_FREE_DISPATCH(FreeToString, std::to_string, ToString);
+
+struct Stringable : pro::facade_builder
+    ::add_convention<FreeToString, std::string() const>
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::support_embedded_meta
+    ::build {};
+
+int main() {
+  static_assert(sizeof(pro::proxy<Stringable>) == sizeof(void*));
+  static_assert(!pro::inplace_proxiable_target<int, Stringable>);
+  std::vector<pro::proxy<Stringable>> v;
+  v.push_back(pro::make_proxy<Stringable>(123));
+  v.push_back(pro::make_proxy<Stringable>(0.5));
+  v.insert(v.begin(), v.back());  // Allocates a copy of 0.5 with its own header
+  for (auto& p : v) {
+    std::cout << ToString(*p) << "\n";  // Prints "0.500000", "123" and "0.500000"
+  }
+}
@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from support_indexed_meta.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_FREE_DISPATCH(FreeToString, std::to_string, ToString);
+
+struct CompactStringable : pro::facade_builder
+    ::add_convention<FreeToString, std::string() const>
+    ::restrict_layout<4>
+    ::support_indexed_meta
+    ::build {};
+
+int main() {
+  static_assert(sizeof(pro::proxy<CompactStringable>) == 8);
+  pro::proxy<CompactStringable> p1 = pro::make_proxy<CompactStringable>(123);
+  pro::proxy<CompactStringable> p2 = pro::make_proxy<CompactStringable>(0.5f);
+  std::cout << ToString(*p1) << "\n";  // Prints "123"
+  std::cout << ToString(*p2) << "\n";  // Prints "0.500000"
+}
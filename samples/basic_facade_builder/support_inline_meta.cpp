@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from support_inline_meta.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+PRO_DEF_MEM_DISPATCH(MemPerimeter, Perimeter);
+
+struct Shape : pro::facade_builder
+    ::add_convention<MemArea, double() const>
+    ::add_convention<MemPerimeter, double() const>
+    ::build {};
+
+// Relocation, destruction, Area and Perimeter take 4 dispatchers
+struct HotShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::support_inline_meta<4>
+    ::build {};
+
+struct DenseShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::support_inline_meta<0>
+    ::build {};
+
+struct Square {
+  double Area() const { return side * side; }
+  double Perimeter() const { return 4 * side; }
+
+  double side;
+};
+
+int main() {
+  static_assert(sizeof(pro::proxy<HotShape>) == sizeof(void*) * 6);
+  static_assert(sizeof(pro::proxy<DenseShape>) == sizeof(void*) * 3);
+  pro::proxy<HotShape> p1 = pro::make_proxy<HotShape>(Square{2.0});
+  pro::proxy<DenseShape> p2 = pro::make_proxy<DenseShape>(Square{3.0});
+  std::cout << p1->Area() << "\n";  // Prints "4"
+  std::cout << p2->Perimeter() << "\n";  // Prints "12"
+}
@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from support_typeid.md.
+
+#include <iostream>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+
+struct Shape : pro::facade_builder
+    ::add_convention<MemArea, double() const>
+    ::support_typeid
+    ::build {};
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+
+  double side;
+};
+
+struct Circle {
+  double Area() const noexcept { return 3.14159 * radius * radius; }
+
+  double radius;
+};
+
+int main() {
+  pro::proxy<Shape> p = pro::make_proxy<Shape, Square>(2.0);
+  std::cout << p->Area() << "\n";  // Prints: "4"
+  if (const Square* sq = pro::proxy_cast<Square>(&p)) {
+    std::cout << sq->side << "\n";  // Prints: "2"
+  }
+  std::cout << (pro::proxy_cast<Circle>(&p) == nullptr) << "\n";  // Prints: "1"
+}
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from support_weak.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Container : pro::facade_builder
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::support_weak
+    ::build {};
+
+int main() {
+  pro::proxy<Container> p = pro::make_proxy_shared<Container, std::string>("Hello");
+  pro::weak_proxy<Container> wp = p;
+  if (pro::proxy<Container> locked = wp.lock()) {
+    std::cout << locked->size() << "\n";  // Prints: "5"
+  }
+  p.reset();
+  std::cout << std::boolalpha << wp.expired() << "\n";  // Prints: "true"
+  std::cout << wp.lock().has_value() << "\n";  // Prints: "false"
+}
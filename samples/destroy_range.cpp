@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from destroy_range.md.
+
+#include <iostream>
+#include <memory>
+
+#include "proxy.h"
+
+struct Noisy {
+  ~Noisy() { std::cout << "Destroyed\n"; }
+};
+
+struct Any : pro::facade_builder::build {};
+
+int main() {
+  std::allocator<pro::proxy<Any>> alloc;
+  pro::proxy<Any>* data = alloc.allocate(3);
+  std::construct_at(data, pro::make_proxy<Any, int>(1));
+  std::construct_at(data + 1, std::make_unique<Noisy>());
+  std::construct_at(data + 2, pro::make_proxy<Any, int>(2));
+  pro::destroy_range(data, data + 3);  // Prints "Destroyed" once
+  alloc.deallocate(data, 3);
+}
@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from is_trivially_relocatable.md.
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Sized : pro::facade_builder
+    ::support_relocation<pro::constraint_level::trivial>
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::build {};
+
+// A minimal owning pointer that holds no reference to itself
+template <class T>
+class Box {
+ public:
+  explicit Box(T* ptr) noexcept : ptr_(ptr) {}
+  Box(Box&& rhs) noexcept : ptr_(std::exchange(rhs.ptr_, nullptr)) {}
+  ~Box() { delete ptr_; }
+  T& operator*() const noexcept { return *ptr_; }
+
+ private:
+  T* ptr_;
+};
+
+template <class T>
+struct pro::is_trivially_relocatable<Box<T>> : std::true_type {};
+
+int main() {
+  pro::proxy<Sized> p1 = std::make_unique<std::string>("Hello");
+  pro::proxy<Sized> p2 = Box<std::string>{new std::string(64, '-')};
+  pro::proxy<Sized> p3 = pro::make_proxy<Sized, std::string>(100, 'x');
+  auto p4 = std::move(p3);  // Copies bytes without indirect call
+  std::cout << p1->size() << "\n";  // Prints "5"
+  std::cout << p2->size() << "\n";  // Prints "64"
+  std::cout << p4->size() << "\n";  // Prints "100"
+}
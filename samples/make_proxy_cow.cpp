@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from make_proxy_cow.md.
+
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemAt, at);
+PRO_DEF_MEM_DISPATCH(MemInsertOrAssign, insert_or_assign);
+
+struct Config : pro::facade_builder
+    ::add_convention<MemAt, const std::string&(const std::string&) const>
+    ::add_convention<MemInsertOrAssign, void(const std::string&, const std::string&)>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::restrict_layout<sizeof(void*)>
+    ::build {};
+
+int main() {
+  pro::proxy<Config> current = pro::make_proxy_cow<Config, std::map<std::string, std::string>>();
+  current->insert_or_assign("mode", "fast");
+  pro::proxy<Config> snapshot = current;  // No allocation
+  current->insert_or_assign("mode", "safe");  // Copies the map, since it is shared with snapshot
+  std::cout << snapshot->at("mode") << "\n";  // Prints: "fast"
+  std::cout << current->at("mode") << "\n";  // Prints: "safe"
+}
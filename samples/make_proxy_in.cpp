@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from make_proxy_in.md.
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Sized : pro::facade_builder
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::build {};
+
+int main() {
+  pro::arena arena;
+  for (int frame = 0; frame < 3; ++frame) {
+    {
+      std::vector<pro::proxy<Sized>> objects;
+      objects.push_back(pro::make_proxy_in<Sized, std::array<int, 100>>(arena));
+      objects.push_back(pro::make_proxy_in<Sized, std::string>(arena, "Hello"));
+      std::size_t total = 0;
+      for (auto& p : objects) {
+        total += p->size();
+      }
+      std::cout << total << "\n";  // Prints: "105"
+    }  // All the proxies are destroyed before the arena is reset
+    arena.reset();
+  }
+}
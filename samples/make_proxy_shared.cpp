@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from make_proxy_shared.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemAppend, append);
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Buffer : pro::facade_builder
+    ::add_convention<MemAppend, std::string&(const char*)>
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::restrict_layout<sizeof(void*)>
+    ::build {};
+
+int main() {
+  pro::proxy<Buffer> p1 = pro::make_proxy_shared<Buffer, std::string>("Hello");
+  pro::proxy<Buffer> p2 = p1;  // Shares ownership, no allocation
+  p2->append(" World");
+  std::cout << p1->size() << "\n";  // Prints: "11"
+
+  // Reference counting without atomic operations for thread-confined objects
+  pro::proxy<Buffer> p3 = pro::make_proxy_shared<Buffer, std::string, pro::sharing_policy::plain>(3, 'x');
+  std::cout << p3->size() << "\n";  // Prints: "3"
+}
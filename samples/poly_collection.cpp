@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from poly_collection.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemDraw, Draw);
+
+struct Drawable : pro::facade_builder
+    ::add_convention<MemDraw, void(std::ostream&) const>
+    ::build {};
+
+struct Circle {
+  void Draw(std::ostream& out) const { out << "Circle(" << radius << ")\n"; }
+
+  double radius;
+};
+
+struct Label {
+  void Draw(std::ostream& out) const { out << "Label(" << text << ")\n"; }
+
+  std::string text;
+};
+
+int main() {
+  pro::poly_collection<Drawable> shapes;
+  shapes.emplace<Circle>(1.0);
+  shapes.emplace<Label>("hello");
+  shapes.emplace<Circle>(2.0);
+
+  // Objects of the same type are stored in the same segment and visited together.
+  // Prints "Circle(1)" and "Circle(2)" consecutively, and "Label(hello)" before or after them
+  using C = std::tuple_element_t<0u, Drawable::convention_types>;
+  shapes.invoke<C, void(std::ostream&) const>(std::cout);
+
+  std::cout << shapes.segment<Circle>().size() << "\n";  // Prints "2"
+}
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from upcast.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemDraw, Draw);
+PRO_DEF_MEM_DISPATCH(MemName, Name);
+
+struct Drawable : pro::facade_builder
+    ::add_convention<MemDraw, void(std::ostream&) const>
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::support_inline_meta<0u>  // Refers to the metadata by pointer
+    ::build {};
+
+struct NamedDrawable : pro::facade_builder
+    ::add_facade<Drawable>
+    ::add_convention<MemName, std::string() const>
+    ::build {};
+
+struct Circle {
+  void Draw(std::ostream& out) const { out << "()"; }
+  std::string Name() const { return "circle"; }
+};
+
+void Render(const pro::proxy<Drawable>& d) {
+  d->Draw(std::cout);
+  std::cout << "\n";
+}
+
+int main() {
+  pro::proxy<NamedDrawable> p = pro::make_proxy<NamedDrawable>(Circle{});
+  std::cout << p->Name() << ": ";
+  Render(p);  // Copies the circle. Prints: "circle: ()"
+  pro::proxy<Drawable> d = std::move(p);  // Moves the circle
+  std::cout << std::boolalpha << p.has_value() << "\n";  // Prints: "false"
+  Render(d);  // Prints: "()"
+}
@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_cast.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+struct Identifiable : pro::facade_builder
+    ::support_typeid
+    ::build {};
+
+int main() {
+  pro::proxy<Identifiable> p = pro::make_proxy<Identifiable, std::string>("Hello");
+  if (std::string* s = pro::proxy_cast<std::string>(&p)) {
+    *s += " World";
+  }
+  std::cout << pro::proxy_cast<const std::string&>(p) << "\n";  // Prints: "Hello World"
+  std::cout << (pro::proxy_cast<int>(&p) == nullptr) << "\n";  // Prints: "1"
+  try {
+    pro::proxy_cast<int>(p);
+  } catch (const pro::bad_proxy_cast& e) {
+    std::cout << e.what() << "\n";  // Prints: "pro::bad_proxy_cast"
+  }
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_invoke_batch.md.
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define PRO_ENABLE_PARALLEL
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemOnTick, OnTick);
+PRO_DEF_MEM_DISPATCH(MemName, Name);
+
+struct Actor : pro::facade_builder
+    ::add_convention<MemOnTick, void(int)>
+    ::add_convention<MemName, std::string() const>
+    ::build {};
+
+struct Player {
+  void OnTick(int tick) { score += tick; }
+  std::string Name() const { return "Player(" + std::to_string(score) + ")"; }
+
+  int score = 0;
+};
+
+struct Enemy {
+  void OnTick(int) { --health; }
+  std::string Name() const { return "Enemy(" + std::to_string(health) + ")"; }
+
+  int health = 10;
+};
+
+int main() {
+  std::vector<pro::proxy<Actor>> actors;
+  actors.push_back(pro::make_proxy<Actor, Enemy>());
+  actors.push_back(pro::make_proxy<Actor, Player>());
+  actors.push_back(pro::make_proxy<Actor, Enemy>());
+
+  using OnTick = std::tuple_element_t<0u, Actor::convention_types>;
+  pro::proxy_invoke_batch<OnTick, void(int)>(actors, 1);
+  pro::proxy_invoke_batch<OnTick, void(int)>(pro::group_by_type, actors, 2);
+  pro::proxy_invoke_batch<OnTick, void(int)>(pro::parallel, actors, 3);
+  for (auto& actor : actors) {
+    std::cout << actor->Name() << "\n";
+  }
+  // Prints "Enemy(7)" twice and "Player(6)" once, in an unspecified order
+}
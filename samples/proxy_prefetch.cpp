@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_prefetch.md.
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+
+struct Shape : pro::facade_builder
+    ::add_convention<MemArea, double() const>
+    ::build {};
+
+struct Rectangle {
+  double Area() const { return width * height; }
+
+  double width, height;
+  char padding[48];
+};
+
+int main() {
+  std::vector<pro::proxy<Shape>> shapes;
+  for (int i = 1; i <= 100; ++i) {
+    shapes.push_back(pro::make_proxy<Shape, Rectangle>(1.0 * i, 2.0));
+  }
+  std::ranges::shuffle(shapes, std::minstd_rand{});
+
+  double total = 0.0;
+  for (auto& shape : pro::prefetched(shapes, 8)) {
+    total += shape->Area();
+  }
+  std::cout << total << "\n";  // Prints "10100"
+}
@@ -0,0 +1,24 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_typeid.md.
+
+#include <iostream>
+#include <memory>
+
+#include "proxy.h"
+
+struct Identifiable : pro::facade_builder
+    ::support_typeid
+    ::build {};
+
+int main() {
+  int i = 123;
+  pro::proxy<Identifiable> p = &i;
+  std::cout << std::boolalpha << (pro::proxy_typeid(p) == pro::type_id_of<int>()) << "\n";  // Prints: "true"
+
+  p = std::make_shared<const double>(3.14);
+  std::cout << (pro::proxy_typeid(p) == pro::type_id_of<double>()) << "\n";  // Prints: "true"
+
+  p.reset();
+  std::cout << (pro::proxy_typeid(p) == pro::type_id_of<void>()) << "\n";  // Prints: "true"
+}
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_vector.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+struct Printable : pro::facade_builder
+    ::support_relocation<pro::constraint_level::trivial>
+    ::add_convention<pro::operator_dispatch<"<<", true>, std::ostream&(std::ostream&) const>
+    ::build {};
+
+int main() {
+  pro::proxy_vector<Printable> v;
+  v.push_back(pro::make_proxy<Printable>(123));
+  v.push_back(pro::make_proxy<Printable, std::string>("hello"));  // Heap-backed
+  v.insert(v.begin(), pro::make_proxy<Printable>(3.5));  // Relocates with memmove
+  v.erase(v.begin() + 1);
+  for (auto& p : v) {
+    std::cout << *p << "\n";  // Prints "3.5" and "hello"
+  }
+  std::cout << v.size() << "\n";  // Prints "2"
+}
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_view.md.
+
+#include <iostream>
+#include <string>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemAppend, append);
+PRO_DEF_MEM_DISPATCH(MemSize, size);
+
+struct Buffer : pro::facade_builder
+    ::add_convention<MemAppend, std::string&(const char*)>
+    ::add_convention<MemSize, std::size_t() const noexcept>
+    ::build {};
+
+void AppendGreeting(pro::proxy_view<Buffer> buffer) {
+  buffer->append("Hello");
+}
+
+int main() {
+  std::string s;
+  AppendGreeting(pro::make_proxy_view<Buffer>(s));  // No allocation, no copy of s
+  std::cout << s << "\n";  // Prints: "Hello"
+  pro::proxy_view<Buffer> v = pro::make_proxy_view<Buffer>(s);
+  std::cout << v->size() << "\n";  // Prints: "5"
+}
@@ -0,0 +1,40 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+// This file contains example code from proxy_visit.md.
+
+#include <iostream>
+#include <numbers>
+#include <vector>
+
+#include "proxy.h"
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+
+struct Shape : pro::facade_builder
+    ::add_convention<MemArea, double() const>
+    ::build {};
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+
+  double side;
+};
+
+struct Circle {
+  double Area() const noexcept { return std::numbers::pi * radius * radius; }
+
+  double radius;
+};
+
+int main() {
+  std::vector<pro::proxy<Shape>> shapes;
+  shapes.push_back(pro::make_proxy<Shape, Square>(2.0));
+  shapes.push_back(pro::make_proxy<Shape, Circle>(1.0));
+  double total = 0.0;
+  for (const auto& shape : shapes) {
+    total += pro::proxy_visit<Square>(shape,
+        [](const Square& square) { return square.Area(); },  // Can be inlined
+        [](const pro::proxy<Shape>& other) { return other->Area(); });
+  }
+  std::cout << total << "\n";  // Prints: "7.14159"
+}
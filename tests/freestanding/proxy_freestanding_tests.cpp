@@ -20,6 +20,9 @@ PRO_DEF_WEAK_DISPATCH(WeakFreeGetHash, FreeGetHash, GetDefaultHash);
 struct Hashable : pro::facade_builder
     ::add_convention<WeakFreeGetHash, unsigned()>
     ::build {};
+struct Identifiable : pro::facade_builder
+    ::support_typeid
+    ::build {};
 
 extern "C" int main() {
   int i = 123;
@@ -43,5 +46,10 @@ extern "C" int main() {
   if (GetHash(*p) != GetDefaultHash()) {
     return 1;
   }
+  pro::proxy<Identifiable> q = &i;
+  if (pro::proxy_typeid(q) != pro::type_id_of<int>() ||
+      pro::proxy_cast<int>(&q) != &i || pro::proxy_cast<double>(&q) != nullptr) {
+    return 1;
+  }
   return 0;
 }
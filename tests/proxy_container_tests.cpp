@@ -0,0 +1,457 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+#define PRO_ENABLE_PARALLEL
+#include "proxy.h"
+#include "utils.h"
+
+namespace {
+
+namespace spec {
+
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+PRO_DEF_MEM_DISPATCH(MemScale, Scale);
+
+struct Shape : pro::facade_builder
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::add_convention<MemArea, double() const>
+    ::add_convention<MemScale, void(double)>
+    ::build {};
+
+class Square {
+ public:
+  explicit Square(double side) : side_(side) {}
+  double Area() const noexcept { return side_ * side_; }
+  void Scale(double factor) noexcept { side_ *= factor; }
+
+ private:
+  double side_;
+};
+
+class Rectangle {
+ public:
+  Rectangle(double width, double height) : width_(width), height_(height) {}
+  double Area() const noexcept { return width_ * height_; }
+  void Scale(double factor) noexcept { width_ *= factor; height_ *= factor; }
+
+ private:
+  double width_;
+  double height_;
+  std::string padding_[4];  // Larger than the default inline storage of proxy
+};
+
+struct Accumulator {
+  double Area() const noexcept { return 0.0; }
+  void Scale(double factor) noexcept { factors.push_back(factor); }
+
+  std::vector<double> factors;
+};
+
+struct TrackedStringable : pro::facade_builder
+    ::support_relocation<pro::constraint_level::nontrivial>
+    ::add_convention<utils::spec::FreeToString, std::string()>
+    ::build {};
+
+struct MovableStringable : pro::facade_builder
+    ::add_convention<utils::spec::FreeToString, std::string()>
+    ::build {};
+
+struct TriviallyRelocatableStringable : pro::facade_builder
+    ::support_relocation<pro::constraint_level::trivial>
+    ::add_convention<utils::spec::FreeToString, std::string()>
+    ::build {};
+
+// Not trivially relocatable, and counts the moves that relocate it
+struct MoveCountingPtr {
+  MoveCountingPtr(const int* value, int* moves) noexcept
+      : value(value), moves(moves) {}
+  MoveCountingPtr(MoveCountingPtr&& rhs) noexcept
+      : value(rhs.value), moves(rhs.moves) { ++*moves; }
+  const int& operator*() const noexcept { return *value; }
+
+  const int* value;
+  int* moves;
+};
+
+PRO_DEF_FREE_DISPATCH(FreeAdvance, Advance);
+PRO_DEF_FREE_DISPATCH(FreeEnergy, Energy);
+
+struct Particle : pro::facade_builder
+    ::add_bulk_convention<FreeAdvance, void(float)>
+    ::add_bulk_convention<FreeEnergy, float() const>
+    ::build {};
+
+struct Dust {
+  float position;
+  float velocity;
+
+  static inline int bulk_calls = 0;
+};
+
+void Advance(Dust& self, float dt) { self.position += self.velocity * dt; }
+void Advance(std::span<Dust> self, float dt) {
+  ++Dust::bulk_calls;
+  for (Dust& d : self) { Advance(d, dt); }
+}
+float Energy(const Dust& self) { return self.velocity * self.velocity / 2.0f; }
+void Energy(std::span<const Dust> self, std::span<float> results) {
+  ++Dust::bulk_calls;
+  for (std::size_t i = 0; i < self.size(); ++i) { results[i] = Energy(self[i]); }
+}
+
+struct Rock {
+  float position;
+};
+
+void Advance(Rock&, float) {}
+float Energy(const Rock&) { return 0.0f; }
+
+using AreaConvention = std::tuple_element_t<0u, Shape::convention_types>;
+using ScaleConvention = std::tuple_element_t<1u, Shape::convention_types>;
+using AdvanceConvention = std::tuple_element_t<0u, Particle::convention_types>;
+using EnergyConvention = std::tuple_element_t<1u, Particle::convention_types>;
+
+}  // namespace spec
+
+}  // namespace
+
+TEST(ProxyContainerTests, TestPolyCollection_Segments) {
+  pro::poly_collection<spec::Shape> c;
+  ASSERT_TRUE(c.empty());
+  c.emplace<spec::Square>(1.0);
+  c.emplace<spec::Rectangle>(2.0, 3.0);
+  c.emplace<spec::Square>(2.0);
+  c.insert(spec::Square{3.0});
+  ASSERT_FALSE(c.empty());
+  ASSERT_EQ(c.size(), 4u);
+  ASSERT_EQ(c.segment_count(), 2u);
+  auto squares = c.segment<spec::Square>();
+  ASSERT_EQ(squares.size(), 3u);
+  ASSERT_EQ(squares[0].Area(), 1.0);
+  ASSERT_EQ(squares[1].Area(), 4.0);
+  ASSERT_EQ(squares[2].Area(), 9.0);
+  ASSERT_EQ(c.segment<spec::Rectangle>().size(), 1u);
+  ASSERT_TRUE(c.segment<spec::Accumulator>().empty());
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_Invoke) {
+  pro::poly_collection<spec::Shape> c;
+  for (int i = 1; i <= 100; ++i) {
+    if (i % 2 == 0) {
+      c.emplace<spec::Square>(i);
+    } else {
+      c.emplace<spec::Rectangle>(i, 2.0);
+    }
+  }
+  c.invoke<spec::ScaleConvention, void(double)>(2.0);
+  double expected = 0.0;
+  for (int i = 1; i <= 100; ++i) {
+    expected += i % 2 == 0 ? 4.0 * i * i : 8.0 * i;
+  }
+  double actual = 0.0;
+  for (auto& s : c.segment<spec::Square>()) { actual += s.Area(); }
+  for (auto& r : c.segment<spec::Rectangle>()) { actual += r.Area(); }
+  ASSERT_DOUBLE_EQ(actual, expected);
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_InvokeOrderWithinSegment) {
+  pro::poly_collection<spec::Shape> c;
+  c.emplace<spec::Accumulator>();
+  const pro::poly_collection<spec::Shape>& cc = c;
+  cc.invoke<spec::AreaConvention, double() const>();
+  c.invoke<spec::ScaleConvention, void(double)>(1.5);
+  c.invoke<spec::ScaleConvention, void(double)>(2.5);
+  ASSERT_EQ(c.segment<spec::Accumulator>()[0].factors,
+      (std::vector<double>{1.5, 2.5}));
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_BulkConvention) {
+  pro::poly_collection<spec::Particle> c;
+  for (int i = 0; i < 10; ++i) {
+    c.emplace<spec::Dust>(0.0f, 1.0f * i);
+  }
+  c.emplace<spec::Rock>(1.0f);
+  c.emplace<spec::Rock>(2.0f);
+  spec::Dust::bulk_calls = 0;
+  c.invoke<spec::AdvanceConvention, void(float)>(2.0f);
+  ASSERT_EQ(spec::Dust::bulk_calls, 1);
+  auto dust = c.segment<spec::Dust>();
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(dust[i].position, 2.0f * i);
+  }
+  ASSERT_EQ(c.segment<spec::Rock>()[1].position, 2.0f);
+
+  std::vector<float> energies(c.size(), -1.0f);
+  const pro::poly_collection<spec::Particle>& cc = c;
+  cc.invoke_into<spec::EnergyConvention, float() const>(energies);
+  ASSERT_EQ(spec::Dust::bulk_calls, 2);
+  float total = 0.0f;
+  for (float e : energies) {
+    ASSERT_GE(e, 0.0f);
+    total += e;
+  }
+  ASSERT_EQ(total, 142.5f);
+
+  // Results are discarded by invoke, so the scalar implementation is used
+  cc.invoke<spec::EnergyConvention, float() const>();
+  ASSERT_EQ(spec::Dust::bulk_calls, 2);
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_Parallel) {
+  pro::poly_collection<spec::Particle> c;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 3 == 0) {
+      c.emplace<spec::Rock>(1.0f * i);
+    } else {
+      c.emplace<spec::Dust>(0.0f, 1.0f * i);
+    }
+  }
+  const pro::poly_collection<spec::Particle>& cc = c;
+  std::vector<float> expected(c.size());
+  cc.invoke_into<spec::EnergyConvention, float() const>(expected);
+  for (std::size_t threads : {0u, 1u, 3u, 64u}) {
+    std::vector<float> actual(c.size(), -1.0f);
+    cc.invoke_into<spec::EnergyConvention, float() const>(pro::parallel_t{threads}, actual);
+    ASSERT_EQ(actual, expected);
+  }
+  c.invoke<spec::AdvanceConvention, void(float)>(pro::parallel, 2.0f);
+  auto dust = c.segment<spec::Dust>();
+  for (std::size_t i = 0; i < dust.size(); ++i) {
+    ASSERT_EQ(dust[i].position, 2.0f * dust[i].velocity);
+  }
+  pro::poly_collection<spec::Particle> empty;
+  empty.invoke<spec::AdvanceConvention, void(float)>(pro::parallel, 2.0f);
+}
+
+TEST(ProxyContainerTests, TestBulkConvention_Proxy) {
+  pro::proxy<spec::Particle> p = pro::make_proxy<spec::Particle, spec::Dust>(1.0f, 3.0f);
+  Advance(*p, 2.0f);
+  ASSERT_EQ(Energy(*p), 4.5f);
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_Lifetime) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::poly_collection<spec::TrackedStringable> c;
+    c.emplace<utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    c.emplace<utils::LifetimeTracker::Session>(&tracker);  // Grows the segment
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kValueConstruction);
+    expected_ops.emplace_back(3, utils::LifetimeOperationType::kCopyConstruction);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    ASSERT_EQ(to_string(c.segment<utils::LifetimeTracker::Session>()[0]),
+        "Session 3");
+  }
+  expected_ops.emplace_back(3, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_Copy) {
+  pro::poly_collection<spec::Shape> c1;
+  c1.emplace<spec::Square>(2.0);
+  c1.emplace<spec::Rectangle>(2.0, 3.0);
+  pro::poly_collection<spec::Shape> c2 = c1;
+  c2.invoke<spec::ScaleConvention, void(double)>(10.0);
+  ASSERT_EQ(c2.size(), 2u);
+  ASSERT_EQ(c1.segment<spec::Square>()[0].Area(), 4.0);
+  ASSERT_EQ(c2.segment<spec::Square>()[0].Area(), 400.0);
+  ASSERT_EQ(c1.segment<spec::Rectangle>()[0].Area(), 6.0);
+  ASSERT_EQ(c2.segment<spec::Rectangle>()[0].Area(), 600.0);
+}
+
+TEST(ProxyContainerTests, TestPolyCollection_MoveAndClear) {
+  pro::poly_collection<spec::Shape> c1;
+  c1.emplace<spec::Square>(2.0);
+  pro::poly_collection<spec::Shape> c2 = std::move(c1);
+  ASSERT_TRUE(c1.empty());
+  ASSERT_EQ(c1.segment_count(), 0u);
+  ASSERT_EQ(c2.size(), 1u);
+  swap(c1, c2);
+  ASSERT_EQ(c1.size(), 1u);
+  ASSERT_TRUE(c2.empty());
+  c1.clear();
+  ASSERT_TRUE(c1.empty());
+  ASSERT_EQ(c1.segment_count(), 0u);
+}
+
+TEST(ProxyContainerTests, TestProxyVector_PushBackAndGrow) {
+  pro::proxy_vector<spec::Shape> v;
+  ASSERT_TRUE(v.empty());
+  for (int i = 1; i <= 100; ++i) {
+    if (i % 2 == 0) {
+      v.push_back(pro::make_proxy<spec::Shape, spec::Square>(i));
+    } else {
+      v.emplace_back(pro::make_proxy<spec::Shape, spec::Rectangle>(i, 2.0));
+    }
+  }
+  ASSERT_EQ(v.size(), 100u);
+  ASSERT_GE(v.capacity(), 100u);
+  for (int i = 1; i <= 100; ++i) {
+    ASSERT_EQ(v[i - 1]->Area(), i % 2 == 0 ? 1.0 * i * i : 2.0 * i);
+  }
+  v.shrink_to_fit();
+  ASSERT_EQ(v.capacity(), 100u);
+  ASSERT_EQ(v.back()->Area(), 10000.0);
+  v.pop_back();
+  ASSERT_EQ(v.size(), 99u);
+  ASSERT_EQ(v.back()->Area(), 198.0);
+}
+
+TEST(ProxyContainerTests, TestProxyVector_InsertAndErase) {
+  pro::proxy_vector<spec::MovableStringable> v;
+  v.reserve(4u);
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(pro::make_proxy<spec::MovableStringable>(i));
+  }
+  v.insert(v.begin() + 1, pro::make_proxy<spec::MovableStringable>(10));  // Grows
+  v.insert(v.begin(), pro::make_proxy<spec::MovableStringable>(20));
+  v.emplace(v.end(), pro::make_proxy<spec::MovableStringable>(30));
+  auto to_strings = [&] {
+    std::vector<std::string> result;
+    for (auto& p : v) { result.push_back(ToString(*p)); }
+    return result;
+  };
+  ASSERT_EQ(to_strings(),
+      (std::vector<std::string>{"20", "0", "10", "1", "2", "3", "30"}));
+  auto it = v.erase(v.begin() + 2);
+  ASSERT_EQ(ToString(**it), "1");
+  it = v.erase(v.begin(), v.begin() + 2);
+  ASSERT_EQ(it, v.begin());
+  ASSERT_EQ(to_strings(), (std::vector<std::string>{"1", "2", "3", "30"}));
+  v.erase(v.end() - 1);
+  ASSERT_EQ(to_strings(), (std::vector<std::string>{"1", "2", "3"}));
+  v.clear();
+  ASSERT_TRUE(v.empty());
+}
+
+TEST(ProxyContainerTests, TestProxyVector_TriviallyRelocatable) {
+  pro::proxy_vector<spec::TriviallyRelocatableStringable> v;
+  for (int i = 0; i < 10; ++i) {
+    v.push_back(std::make_unique<int>(i));
+  }
+  v.insert(v.begin() + 5, pro::make_proxy<spec::TriviallyRelocatableStringable>(100));
+  v.erase(v.begin(), v.begin() + 3);
+  std::string result;
+  for (auto& p : v) { result += ToString(*p); }
+  ASSERT_EQ(result, "3410056789");
+}
+
+TEST(ProxyContainerTests, TestProxyVector_MixedRelocation) {
+  static_assert(!pro::is_trivially_relocatable_v<spec::MoveCountingPtr>);
+  int values[] = {0, 1, 2, 3, 4, 5, 6};
+  int moves = 0;
+  pro::proxy_vector<spec::MovableStringable> v;
+  v.reserve(8u);
+  for (int i = 0; i < 6; ++i) {
+    if (i % 3 == 0) {
+      v.emplace_back(std::in_place_type<spec::MoveCountingPtr>, &values[i], &moves);
+    } else {
+      v.emplace_back(&values[i]);  // Trivially relocatable
+    }
+  }
+  v.emplace_back();
+  ASSERT_EQ(moves, 0);
+  v.insert(v.begin() + 1, &values[6]);  // Shifts 1 of the 6 elements with the dispatcher
+  ASSERT_EQ(moves, 1);
+  v.erase(v.begin());  // Shifts 1 of the 7 elements with the dispatcher
+  ASSERT_EQ(moves, 2);
+  v.reserve(16u);  // Relocates 1 of the 7 elements with the dispatcher
+  ASSERT_EQ(moves, 3);
+  v.pop_back();
+  std::string result;
+  for (auto& p : v) { result += ToString(*p); }
+  ASSERT_EQ(result, "612345");
+}
+
+TEST(ProxyContainerTests, TestProxyVector_EraseEmptyRange) {
+  int values[] = {0, 1, 2};
+  int moves = 0;
+  pro::proxy_vector<spec::MovableStringable> v;
+  for (int i = 0; i < 3; ++i) {
+    v.emplace_back(std::in_place_type<spec::MoveCountingPtr>, &values[i], &moves);
+  }
+  moves = 0;
+  auto it = v.erase(v.begin() + 1, v.begin() + 1);
+  ASSERT_EQ(it, v.begin() + 1);
+  ASSERT_EQ(moves, 0);
+  v.erase(v.end(), v.end());
+  ASSERT_EQ(v.size(), 3u);
+  std::string result;
+  for (auto& p : v) { result += ToString(*p); }
+  ASSERT_EQ(result, "012");
+}
+
+TEST(ProxyContainerTests, TestProxyVector_Lifetime) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    pro::proxy_vector<spec::MovableStringable> v;
+    for (int i = 1; i <= 3; ++i) {
+      v.push_back(pro::make_proxy<spec::MovableStringable, utils::LifetimeTracker::Session>(&tracker));
+      expected_ops.emplace_back(i, utils::LifetimeOperationType::kValueConstruction);
+    }
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);  // Growing relocates pointers only
+    v.erase(v.begin());
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    ASSERT_EQ(ToString(*v.front()), "Session 2");
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(3, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyContainerTests, TestProxyVector_CopyAndMove) {
+  pro::proxy_vector<spec::Shape> v1;
+  v1.push_back(pro::make_proxy<spec::Shape, spec::Square>(2.0));
+  v1.push_back(pro::make_proxy<spec::Shape, spec::Rectangle>(2.0, 3.0));
+  pro::proxy_vector<spec::Shape> v2 = v1;
+  for (auto& p : v2) { p->Scale(10.0); }
+  ASSERT_EQ(v1[0]->Area(), 4.0);
+  ASSERT_EQ(v2[0]->Area(), 400.0);
+  ASSERT_EQ(v1[1]->Area(), 6.0);
+  ASSERT_EQ(v2[1]->Area(), 600.0);
+  pro::proxy_vector<spec::Shape> v3 = std::move(v2);
+  ASSERT_TRUE(v2.empty());
+  ASSERT_EQ(v3.size(), 2u);
+  swap(v2, v3);
+  ASSERT_EQ(v2.size(), 2u);
+  ASSERT_TRUE(v3.empty());
+  v3 = v2;
+  ASSERT_EQ(v3.front()->Area(), 400.0);
+}
+
+TEST(ProxyContainerTests, TestDestroyRange) {
+  using P = pro::proxy<spec::MovableStringable>;
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{ &tracker };
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+  std::allocator<P> alloc;
+  P* data = alloc.allocate(6u);
+  std::construct_at(data, &session);
+  std::construct_at(data + 1, pro::make_proxy<spec::MovableStringable, utils::LifetimeTracker::Session>(&tracker));
+  std::construct_at(data + 2, pro::make_proxy<spec::MovableStringable, utils::LifetimeTracker::Session>(&tracker));
+  std::construct_at(data + 3);
+  std::construct_at(data + 4, &session);
+  std::construct_at(data + 5, pro::make_proxy<spec::MovableStringable, utils::LifetimeTracker::Session>(&tracker));
+  for (int i = 2; i <= 4; ++i) {
+    expected_ops.emplace_back(i, utils::LifetimeOperationType::kValueConstruction);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  pro::destroy_range(data, data + 6);
+  for (int i = 2; i <= 4; ++i) {
+    expected_ops.emplace_back(i, utils::LifetimeOperationType::kDestruction);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  alloc.deallocate(data, 6u);
+}
@@ -2,7 +2,11 @@
 // Licensed under the MIT License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <memory_resource>
+#include <vector>
 #include "proxy.h"
 #include "utils.h"
 
@@ -24,6 +28,31 @@ struct SboObserver {
   bool AllocatorAllocatesForItself;
 };
 
+struct AllocationCounter {
+  static inline int AllocationCount = 0;
+  static inline int DeallocationCount = 0;
+};
+
+template <class T>
+struct CountingAllocator {
+  using value_type = T;
+
+  CountingAllocator() noexcept = default;
+  template <class U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    ++AllocationCounter::AllocationCount;
+    return std::allocator<T>{}.allocate(n);
+  }
+  void deallocate(T* p, std::size_t n) noexcept {
+    ++AllocationCounter::DeallocationCount;
+    std::allocator<T>{}.deallocate(p, n);
+  }
+  template <class U>
+  bool operator==(const CountingAllocator<U>&) const noexcept { return true; }
+};
+
 namespace spec {
 
 struct TestLargeStringable : pro::facade_builder
@@ -38,8 +67,60 @@ struct TestSmallStringable : pro::facade_builder
     ::restrict_layout<sizeof(void*)>
     ::build {};
 
+struct TestCountingFacade : pro::facade_builder
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::support_allocator<CountingAllocator<void>>
+    ::build {};
+
+struct TestArenaStringable : pro::facade_builder
+    ::add_convention<utils::spec::FreeToString, std::string()>
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::build {};
+
+struct TestSharedStringable : pro::facade_builder
+    ::add_convention<utils::spec::FreeToString, std::string()>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::support_weak
+    ::restrict_layout<sizeof(void*)>
+    ::build {};
+
+PRO_DEF_FREE_DISPATCH(FreeToMutableString, to_string, ToMutableString);
+
+struct TestCowStringable : pro::facade_builder
+    ::add_convention<utils::spec::FreeToString, std::string() const>
+    ::add_convention<FreeToMutableString, std::string()>
+    ::support_copy<pro::constraint_level::nothrow>
+    ::restrict_layout<sizeof(void*)>
+    ::build {};
+
+PRO_DEF_MEM_DISPATCH(MemAddress, Address);
+
+struct TestCacheLineFacade : pro::facade_builder
+    ::add_convention<MemAddress, std::uintptr_t() const noexcept>
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::add_reflection<SboObserver>
+    ::expand_layout<64u, 64u>
+    ::build {};
+
+struct TestSmallCacheLineFacade : pro::facade_builder
+    ::add_facade<TestCacheLineFacade>
+    ::restrict_layout<sizeof(void*)>
+    ::build {};
+
 }  // namespace spec
 
+struct alignas(64) CacheLineCounter {
+  std::uintptr_t Address() const noexcept { return reinterpret_cast<std::uintptr_t>(this); }
+
+  long Value = 0;
+};
+
+struct alignas(128) OverAlignedBuffer {
+  std::uintptr_t Address() const noexcept { return reinterpret_cast<std::uintptr_t>(this); }
+
+  std::array<std::byte, 200> Data{};
+};
+
 PRO_DEF_MEM_DISPATCH(MemFn0, MemFn0);
 struct TestMemFn0 : pro::facade_builder
     ::add_convention<MemFn0, void(int) noexcept>
@@ -542,3 +623,425 @@ TEST(ProxyCreationTests, TestMakeProxy_WithoutSBO_Lifetime_Move) {
   expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
+
+TEST(ProxyCreationTests, TestMakeProxy_OverAligned_Inplace) {
+  std::vector<pro::proxy<spec::TestCacheLineFacade>> v;
+  for (int i = 0; i < 4; ++i) {
+    v.push_back(pro::make_proxy<spec::TestCacheLineFacade, CacheLineCounter>());
+  }
+  v.push_back(v.front());
+  for (auto& p : v) {
+    ASSERT_TRUE(pro::proxy_reflect<SboObserver>(p).SboEnabled);
+    ASSERT_EQ(p->Address() % 64u, 0u);
+  }
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    ASSERT_GE(v[i]->Address() - v[i - 1]->Address(), 64u);  // Distinct cache lines
+  }
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_OverAligned_Allocated) {
+  auto p1 = pro::make_proxy<spec::TestCacheLineFacade, OverAlignedBuffer>();
+  ASSERT_FALSE(pro::proxy_reflect<SboObserver>(p1).SboEnabled);
+  ASSERT_FALSE(pro::proxy_reflect<SboObserver>(p1).AllocatorAllocatesForItself);
+  ASSERT_EQ(p1->Address() % 128u, 0u);
+  auto p2 = p1;
+  ASSERT_EQ(p2->Address() % 128u, 0u);
+  auto p3 = pro::make_proxy<spec::TestSmallCacheLineFacade, CacheLineCounter>();
+  ASSERT_FALSE(pro::proxy_reflect<SboObserver>(p3).SboEnabled);
+  ASSERT_FALSE(pro::proxy_reflect<SboObserver>(p3).AllocatorAllocatesForItself);
+  ASSERT_EQ(p3->Address() % 64u, 0u);
+  auto p4 = p3;
+  ASSERT_EQ(p4->Address() % 64u, 0u);
+}
+
+TEST(ProxyCreationTests, TestAllocateProxy_OverAligned_MemoryResource) {
+  std::pmr::monotonic_buffer_resource resource;
+  std::pmr::polymorphic_allocator<> alloc{&resource};
+  for (int i = 0; i < 4; ++i) {
+    auto p1 = pro::allocate_proxy<spec::TestSmallCacheLineFacade, OverAlignedBuffer>(alloc);
+    ASSERT_TRUE(pro::proxy_reflect<SboObserver>(p1).AllocatorAllocatesForItself);
+    ASSERT_EQ(p1->Address() % 128u, 0u);
+    auto p2 = pro::allocate_proxy<spec::TestCacheLineFacade, OverAlignedBuffer>(alloc);
+    ASSERT_EQ(p2->Address() % 128u, 0u);
+    auto p3 = p1;
+    ASSERT_EQ(p3->Address() % 128u, 0u);
+  }
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_InPlace) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session>(&tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_InPlaceInitializerList) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session>({ 1, 2, 3 }, &tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kInitializerListConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    {
+      auto p2 = p1;
+      ASSERT_TRUE(p1.has_value());
+      ASSERT_TRUE(p2.has_value());
+      ASSERT_EQ(ToString(*p2), "Session 1");
+      ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    }
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_Lifetime_Move) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyShared_PlainPolicy_FromValue) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{ &tracker };
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+  {
+    auto p1 = pro::make_proxy_shared<spec::TestSharedStringable, pro::sharing_policy::plain>(session);
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kCopyConstruction);
+    auto p2 = p1;
+    p1.reset();
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestAllocateProxyShared_Lifetime_Copy) {
+  std::pmr::unsynchronized_pool_resource memory_pool;
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::allocate_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session, pro::sharing_policy::plain>(std::pmr::polymorphic_allocator<>{&memory_pool}, &tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    p1.reset();
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyCow_InPlace) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    const auto p = pro::make_proxy_cow<spec::TestCowStringable, utils::LifetimeTracker::Session>(&tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyCow_InPlaceInitializerList) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy_cow<spec::TestCowStringable, utils::LifetimeTracker::Session>({ 1, 2, 3 }, &tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToMutableString(*p), "Session 1");  // Not shared, so no copy is made
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kInitializerListConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyCow_Lifetime_Copy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_cow<spec::TestCowStringable, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    {
+      auto p2 = p1;
+      ASSERT_EQ(ToString(*p2), "Session 1");
+      ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+      ASSERT_EQ(ToMutableString(*p2), "Session 2");
+      expected_ops.emplace_back(2, utils::LifetimeOperationType::kCopyConstruction);
+      ASSERT_EQ(ToMutableString(*p2), "Session 2");
+      ASSERT_EQ(ToString(*p1), "Session 1");
+      ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    }
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyCow_Lifetime_Move) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_cow<spec::TestCowStringable, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyCow_ExceptionOnCopy) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy_cow<spec::TestCowStringable, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    tracker.ThrowOnNextConstruction();
+    ASSERT_THROW(ToMutableString(*p2), utils::ConstructionFailure);
+    ASSERT_EQ(ToString(*p2), "Session 1");  // Still shared
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestAllocateProxyCow_PlainPolicy_FromValue) {
+  std::pmr::unsynchronized_pool_resource memory_pool;
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{ &tracker };
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+  {
+    auto p1 = pro::allocate_proxy_cow<spec::TestCowStringable, pro::sharing_policy::plain>(std::pmr::polymorphic_allocator<>{&memory_pool}, session);
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kCopyConstruction);
+    auto p2 = p1;
+    p1.reset();
+    ASSERT_EQ(ToMutableString(*p2), "Session 2");  // No longer shared
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestWeakProxy_Lock) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  pro::weak_proxy<spec::TestSharedStringable> wp;
+  ASSERT_TRUE(wp.expired());
+  ASSERT_FALSE(wp.lock().has_value());
+  {
+    auto p1 = pro::make_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    wp = p1;
+    ASSERT_FALSE(wp.expired());
+    auto p2 = wp.lock();
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    p1.reset();
+    ASSERT_FALSE(wp.expired());
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  ASSERT_TRUE(wp.expired());
+  ASSERT_FALSE(wp.lock().has_value());
+}
+
+TEST(ProxyCreationTests, TestWeakProxy_CopyAndMove) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p = pro::make_proxy_shared<spec::TestSharedStringable, utils::LifetimeTracker::Session, pro::sharing_policy::plain>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    pro::weak_proxy<spec::TestSharedStringable> wp1 = p;
+    pro::weak_proxy<spec::TestSharedStringable> wp2 = wp1;
+    pro::weak_proxy<spec::TestSharedStringable> wp3 = std::move(wp1);
+    ASSERT_TRUE(wp1.expired());
+    auto p2 = wp2.lock();
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    p2 = wp3.lock();
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    p2.reset();
+    swap(wp1, wp3);
+    ASSERT_FALSE(wp1.expired());
+    ASSERT_TRUE(wp3.expired());
+    p.reset();
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    ASSERT_TRUE(wp1.expired());
+    ASSERT_TRUE(wp2.expired());
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestWeakProxy_FromUnsharedProxy) {
+  pro::proxy<spec::TestSharedStringable> p = pro::make_proxy<spec::TestSharedStringable>(123);
+  pro::weak_proxy<spec::TestSharedStringable> wp = p;
+  ASSERT_TRUE(p.has_value());
+  ASSERT_TRUE(wp.expired());
+  ASSERT_FALSE(wp.lock().has_value());
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_InPlace) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  pro::arena arena;
+  {
+    auto p = pro::make_proxy_in<spec::TestArenaStringable, utils::LifetimeTracker::Session>(arena, &tracker);
+    ASSERT_TRUE(p.has_value());
+    ASSERT_EQ(ToString(*p), "Session 1");
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_InPlaceInitializerList) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  pro::arena arena;
+  {
+    auto p = pro::make_proxy_in<spec::TestArenaStringable, utils::LifetimeTracker::Session>(arena, { 1, 2, 3 }, &tracker);
+    ASSERT_EQ(ToString(*p), "Session 1");
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kInitializerListConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestArena_AlignmentNearChunkEnd) {
+  // Aligning the next allocation steps past the end of the chunk for some of
+  // the sizes, which must start a new chunk. The first allocation always fits
+  // in the first chunk with its header, which ends before first + 200u
+  for (std::size_t size = 128u; size < 160u; ++size) {
+    pro::arena arena{200u};
+    std::uintptr_t first = reinterpret_cast<std::uintptr_t>(arena.allocate(size, 1u));
+    auto* second = static_cast<std::byte*>(arena.allocate(64u, 64u));
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(second);
+    ASSERT_EQ(address % 64u, 0u);
+    ASSERT_TRUE((address >= first + size && address + 64u <= first + 200u) ||
+        address >= first + 200u || address + 64u <= first);
+    std::fill_n(second, 64u, std::byte{0xFF});
+  }
+}
+
+TEST(ProxyCreationTests, TestArena_ZeroInitialChunkSize) {
+  pro::arena arena{0u};
+  for (std::size_t size : {1u, 8u, 100u, 5000u}) {
+    auto* p = static_cast<std::byte*>(arena.allocate(size, 8u));
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(p) % 8u, 0u);
+    std::fill_n(p, size, std::byte{0xFF});
+  }
+  auto p = pro::make_proxy_in<spec::TestArenaStringable, int>(arena, 123);
+  ASSERT_EQ(ToString(*p), "123");
+}
+
+TEST(ProxyCreationTests, TestArena_SizeOverflow) {
+  pro::arena arena;
+  ASSERT_THROW(arena.allocate(std::numeric_limits<std::size_t>::max() - 8u, 16u), std::bad_alloc);
+  ASSERT_NE(arena.allocate(16u, 16u), nullptr);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_Lifetime_CopyAndMove) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  utils::LifetimeTracker::Session session{ &tracker };
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+  pro::arena arena{64u};
+  {
+    auto p1 = pro::make_proxy_in<spec::TestArenaStringable>(arena, session);
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kCopyConstruction);
+    auto p2 = p1;
+    expected_ops.emplace_back(3, utils::LifetimeOperationType::kCopyConstruction);
+    auto p3 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 3");
+    ASSERT_EQ(ToString(*p3), "Session 2");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(3, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyCreationTests, TestMakeProxyIn_TriviallyDestructible) {
+  struct TrivialFacade : pro::facade_builder
+      ::support_relocation<pro::constraint_level::trivial>
+      ::support_destruction<pro::constraint_level::trivial>
+      ::support_typeid
+      ::build {};
+  static_assert(std::is_trivially_destructible_v<pro::proxy<TrivialFacade>>);
+  pro::arena arena{64u};
+  std::vector<pro::proxy<TrivialFacade>> proxies;
+  for (int i = 0; i < 100; ++i) {
+    proxies.push_back(pro::make_proxy_in<TrivialFacade>(arena, std::array<int, 8>{i}));
+  }
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ((*pro::proxy_cast<std::array<int, 8>>(&proxies[i]))[0], i);
+  }
+  proxies.clear();
+  arena.reset();
+  auto p = pro::make_proxy_in<TrivialFacade, double>(arena, 1.5);
+  ASSERT_TRUE(p.has_value());
+}
+
+TEST(ProxyCreationTests, TestMakeProxy_FacadeAllocator) {
+  AllocationCounter::AllocationCount = 0;
+  AllocationCounter::DeallocationCount = 0;
+  {
+    auto p1 = pro::make_proxy<spec::TestCountingFacade>(123);
+    ASSERT_EQ(AllocationCounter::AllocationCount, 0);  // Stored inplace
+    auto p2 = pro::make_proxy<spec::TestCountingFacade>(std::array<int, 100>{});
+    ASSERT_EQ(AllocationCounter::AllocationCount, 1);
+    auto p3 = p2;
+    ASSERT_EQ(AllocationCounter::AllocationCount, 2);
+    auto p4 = pro::make_proxy_shared<spec::TestCountingFacade, std::string>("Hello");
+    ASSERT_EQ(AllocationCounter::AllocationCount, 3);
+    ASSERT_EQ(AllocationCounter::DeallocationCount, 0);
+  }
+  ASSERT_EQ(AllocationCounter::DeallocationCount, 3);
+}
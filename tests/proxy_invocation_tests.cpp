@@ -3,14 +3,19 @@
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
+#include <memory_resource>
 #include <ranges>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <typeindex>
 #include <typeinfo>
 #include <vector>
+#define PRO_ENABLE_PARALLEL
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(push)
 #pragma warning(disable: 4702)  // False alarm from MSVC: warning C4702: unreachable code
@@ -113,6 +118,96 @@ struct SharedStringable : pro::facade_builder
     ::add_direct_convention<FreeGetWeak<SharedStringable>, pro::proxy<Weak<SharedStringable>>() const&>
     ::build {};
 
+PRO_DEF_MEM_DISPATCH(MemArea, Area);
+PRO_DEF_MEM_DISPATCH(MemScale, Scale);
+
+struct Square {
+  double Area() const noexcept { return side * side; }
+  void Scale(double factor) noexcept { side *= factor; }
+
+  double side;
+};
+
+struct Circle {
+  double Area() const noexcept { return 3.0 * radius * radius; }
+  void Scale(double factor) noexcept { radius *= factor; }
+
+  std::string name;
+  double radius;
+};
+
+struct Shape : pro::facade_builder
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::add_convention<MemArea, double() const>
+    ::add_convention<MemScale, void(double)>
+    ::build {};
+
+struct InlineMetaShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::support_inline_meta<8u>
+    ::build {};
+
+struct IndexedMetaShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::support_indexed_meta
+    ::build {};
+
+template <int I>
+struct IndexedSquare : Square {};
+
+struct HotAreaShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::add_hot_convention<MemArea, double() const>
+    ::build {};
+
+struct IndexedMetaCompactStringable : pro::facade_builder
+    ::add_facade<utils::spec::Stringable>
+    ::restrict_layout<4u>
+    ::support_indexed_meta
+    ::build {};
+
+struct EmbeddedMetaShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::support_embedded_meta
+    ::build {};
+
+struct ClosedShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::expand_layout<sizeof(Circle)>  // The layout of Shape is kept otherwise
+    ::restrict_types<Square, Circle>
+    ::build {};
+
+PRO_DEF_MEM_DISPATCH(MemRelease, Release);
+
+struct ViewableShape : pro::facade_builder
+    ::add_facade<Shape>
+    ::add_convention<MemRelease, std::string() &&>
+    ::support_typeid
+    ::add_view<ViewableShape>
+    ::build {};
+
+struct ReleasableCircle : Circle {
+  std::string Release() && { return std::move(name); }
+};
+
+double ScaleAndMeasure(pro::proxy_view<ViewableShape> v) {
+  v->Scale(2.0);
+  return pro::proxy_invoke<std::tuple_element_t<0u, Shape::convention_types>, double() const>(std::as_const(v));
+}
+
+struct AreaShape : pro::facade_builder
+    ::add_convention<MemArea, double() const>
+    ::support_inline_meta<0u>
+    ::build {};
+
+struct ScalableShape : pro::facade_builder
+    ::add_facade<AreaShape>
+    ::add_convention<MemScale, void(double)>
+    ::add_view<ScalableShape>
+    ::build {};
+
+double Measure(const pro::proxy<Shape>& p) { return p->Area(); }
+
 }  // namespace spec
 
 template <class F, bool NE, class... Args>
@@ -128,6 +223,9 @@ static_assert(CallableFacade<spec::Callable<int(double)>, false, float>);  // In
 static_assert(CallableFacade<spec::Callable<int(double), void(int) noexcept>, true, int>);  // Invoking noexcept overloads
 static_assert(CallableFacade<spec::Callable<int(double), void(int) noexcept>, false, double>);  // Invoking overloads that may throw
 
+template <class F, class T>
+concept ViewableAs = requires(T& value) { pro::make_proxy_view<F>(value); };
+
 template <class... Args>
 std::vector<std::type_index> GetTypeIndices()
     { return {std::type_index{typeid(Args)}...}; }
@@ -328,3 +426,406 @@ TEST(ProxyInvocationTests, TestQualifiedConvention) {
   ASSERT_EQ((*std::move(p))(), 2);
   ASSERT_EQ((*std::move(std::as_const(p)))(), 3);
 }
+
+TEST(ProxyInvocationTests, TestBatchInvocation) {
+  using Callable = spec::Callable<void(std::vector<int>&)>;
+  using C = std::tuple_element_t<0u, Callable::convention_types>;
+  auto f1 = [](std::vector<int>& v) { v.push_back(1); };
+  auto f2 = [](std::vector<int>& v) { v.push_back(2); };
+  std::vector<pro::proxy<Callable>> data;
+  data.push_back(pro::make_proxy<Callable>(f1));
+  data.push_back(pro::make_proxy<Callable>(f1));
+  data.push_back(pro::make_proxy<Callable>(f2));
+  data.push_back(pro::make_proxy<Callable>(f1));
+  data.push_back(pro::make_proxy<Callable>(f2));
+  std::vector<int> result;
+  pro::proxy_invoke_batch<C, void(std::vector<int>&)>(data, result);
+  ASSERT_EQ(result, (std::vector<int>{1, 1, 2, 1, 2}));
+  result.clear();
+  pro::proxy_invoke_batch<C, void(std::vector<int>&)>(std::views::reverse(data), result);
+  ASSERT_EQ(result, (std::vector<int>{2, 1, 2, 1, 1}));
+}
+
+TEST(ProxyInvocationTests, TestBatchInvocation_Const) {
+  struct TestFacade : pro::facade_builder
+      ::add_convention<pro::operator_dispatch<"()">, int() const>
+      ::build {};
+  int counter = 0;
+  auto f = [&counter] { return ++counter; };
+  std::vector<pro::proxy<TestFacade>> data;
+  for (int i = 0; i < 3; ++i) {
+    data.emplace_back(&f);
+  }
+  const auto& callables = data;
+  using C = std::tuple_element_t<0u, TestFacade::convention_types>;
+  pro::proxy_invoke_batch<C, int() const>(callables);
+  ASSERT_EQ(counter, 3);
+}
+
+TEST(ProxyInvocationTests, TestPrefetched) {
+  std::vector<pro::proxy<spec::Shape>> data;
+  for (int i = 0; i < 10; ++i) {
+    if (i % 2 == 0) {
+      data.push_back(pro::make_proxy<spec::Shape, spec::Square>(1.0 * i));
+    } else {
+      data.push_back(pro::make_proxy<spec::Shape, spec::Circle>("c", 1.0 * i));
+    }
+  }
+  pro::proxy<spec::Shape> empty;
+  pro::proxy_prefetch(empty);
+  std::pmr::unsynchronized_pool_resource resource;
+  auto stateful = pro::allocate_proxy<spec::Shape, spec::Circle>(  // Leads with the allocator
+      std::pmr::polymorphic_allocator<>{&resource}, "c", 1.0);
+  pro::proxy_prefetch(stateful);
+  for (std::ptrdiff_t distance : {0, 3, 20}) {
+    double total = 0.0;
+    for (auto& p : pro::prefetched(data, distance)) {
+      total += p->Area();
+    }
+    ASSERT_EQ(total, 0.0 + 3.0 + 4.0 + 27.0 + 16.0 + 75.0 + 36.0 + 147.0 + 64.0 + 243.0);
+  }
+  using C = std::tuple_element_t<1u, spec::Shape::convention_types>;
+  pro::proxy_invoke_batch<C, void(double)>(pro::prefetched(data, 4), 2.0);
+  ASSERT_EQ(data[1]->Area(), 12.0);
+  ASSERT_EQ(data[2]->Area(), 16.0);
+}
+
+TEST(ProxyInvocationTests, TestBatchInvocation_GroupByType) {
+  using Callable = spec::Callable<void(std::vector<int>&)>;
+  using C = std::tuple_element_t<0u, Callable::convention_types>;
+  struct Pusher {
+    void operator()(std::vector<int>& v) const { v.push_back(value); }
+    int value;
+  };
+  auto f = [](std::vector<int>& v) { v.push_back(-1); };
+  std::vector<pro::proxy<Callable>> data;
+  for (int i = 0; i < 4; ++i) {
+    data.push_back(pro::make_proxy<Callable, Pusher>(i));
+    data.push_back(pro::make_proxy<Callable>(f));
+  }
+  std::vector<int> result;
+  pro::proxy_invoke_batch<C, void(std::vector<int>&)>(pro::group_by_type, data, result);
+  ASSERT_EQ(result.size(), 8u);
+  std::vector<int> pushed;
+  std::ranges::copy_if(result, std::back_inserter(pushed), [](int v) { return v >= 0; });
+  ASSERT_EQ(pushed, (std::vector<int>{0, 1, 2, 3}));  // The relative order is stable
+  auto boundary = std::ranges::adjacent_find(result, [](int a, int b) { return (a < 0) != (b < 0); });
+  ASSERT_NE(boundary, result.end());
+  ASSERT_EQ(std::ranges::adjacent_find(std::next(boundary), result.end(),
+      [](int a, int b) { return (a < 0) != (b < 0); }), result.end());  // Grouped in 2 runs
+  result.clear();
+  pro::proxy_invoke_batch<C, void(std::vector<int>&)>(data, result);
+  ASSERT_EQ(result.size(), 8u);
+  // A mutable argument would be shared by all the threads
+  auto parallel_invocable = [](auto& range, auto& arg) requires(requires {
+    pro::proxy_invoke_batch<C, void(std::vector<int>&)>(pro::parallel, range, arg); }) {};
+  static_assert(!std::is_invocable_v<decltype(parallel_invocable), decltype(data)&, decltype(result)&>);
+}
+
+TEST(ProxyInvocationTests, TestBatchInvocation_InlineMeta) {
+  // An inline meta does not identify the pointer type, so the range is neither
+  // split into runs nor reordered by group_by_type
+  std::vector<pro::proxy<spec::InlineMetaShape>> data;
+  for (int i = 0; i < 6; ++i) {
+    if (i % 2 == 0) {
+      data.push_back(pro::make_proxy<spec::InlineMetaShape, spec::Square>(1.0 * i));
+    } else {
+      data.push_back(pro::make_proxy<spec::InlineMetaShape, spec::Circle>("c", 1.0 * i));
+    }
+  }
+  ASSERT_EQ(pro::details::proxy_helper<spec::InlineMetaShape>::get_identity(data[0]), nullptr);
+  using C = std::tuple_element_t<1u, spec::Shape::convention_types>;
+  pro::proxy_invoke_batch<C, void(double)>(pro::group_by_type, data, 2.0);
+  for (int i = 0; i < 6; ++i) {
+    ASSERT_EQ(data[i]->Area(), i % 2 == 0 ? 4.0 * i * i : 12.0 * i * i);
+  }
+}
+
+TEST(ProxyInvocationTests, TestBatchInvocation_Parallel) {
+  std::vector<pro::proxy<spec::Shape>> data;
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 300 < 200) {
+      data.push_back(pro::make_proxy<spec::Shape, spec::Square>(1.0 * i));
+    } else {
+      data.push_back(pro::make_proxy<spec::Shape, spec::Circle>("c", 1.0 * i));
+    }
+  }
+  using C = std::tuple_element_t<1u, spec::Shape::convention_types>;
+  for (std::size_t threads : {0u, 1u, 3u, 64u}) {
+    pro::proxy_invoke_batch<C, void(double)>(pro::parallel_t{threads}, data, 2.0);
+  }
+  pro::proxy_invoke_batch<C, void(double)>(pro::parallel, std::views::take(data, 0), 2.0);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(data[i]->Area(), i % 300 < 200 ? 256.0 * i * i : 768.0 * i * i);
+  }
+}
+
+TEST(ProxyInvocationTests, TestBatchInvocation_ParallelHomogeneous) {
+  std::vector<pro::proxy<spec::Shape>> data;
+  for (int i = 0; i < 1000; ++i) {
+    data.push_back(pro::make_proxy<spec::Shape, spec::Circle>("c", 1.0 * i));
+  }
+  auto bounds = pro::details::parallel_run_bounds<spec::Shape>(data.begin(), data.size(), 32u);
+  ASSERT_GT(bounds.size(), 2u);  // A run of a single type is split into multiple chunks
+  ASSERT_EQ(bounds.front(), 0u);
+  ASSERT_EQ(bounds.back(), 1000u);
+  for (std::size_t i = 1u; i < bounds.size(); ++i) {
+    ASSERT_LT(bounds[i - 1u], bounds[i]);
+    ASSERT_LE(bounds[i] - bounds[i - 1u], 2u * 32u);
+  }
+  using C = std::tuple_element_t<1u, spec::Shape::convention_types>;
+  pro::proxy_invoke_batch<C, void(double)>(pro::parallel_t{4u}, data, 2.0);
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_EQ(data[i]->Area(), 12.0 * i * i);
+  }
+}
+
+TEST(ProxyInvocationTests, TestBatchInvocation_ParallelException) {
+  struct TestFacade : pro::facade_builder
+      ::add_convention<pro::operator_dispatch<"()">, void(int)>
+      ::build {};
+  std::atomic<int> calls = 0;
+  auto f = [&calls](int limit) {
+    if (++calls == limit) { throw std::runtime_error{"limit"}; }
+  };
+  std::vector<pro::proxy<TestFacade>> data;
+  for (int i = 0; i < 100; ++i) {
+    data.emplace_back(&f);
+  }
+  using C = std::tuple_element_t<0u, TestFacade::convention_types>;
+  ASSERT_THROW((pro::proxy_invoke_batch<C, void(int)>(pro::parallel_t{4u}, data, 50)),
+      std::runtime_error);
+  ASSERT_GE(calls.load(), 50);
+}
+
+TEST(ProxyInvocationTests, TestInlineMeta) {
+  static_assert(sizeof(pro::proxy<spec::InlineMetaShape>) == 7 * sizeof(void*));
+  pro::proxy<spec::InlineMetaShape> p1 = pro::make_proxy<spec::InlineMetaShape, spec::Circle>("c", 1.0);
+  pro::proxy<spec::InlineMetaShape> p2 = p1;
+  p2->Scale(2.0);
+  ASSERT_EQ(p1->Area(), 3.0);
+  ASSERT_EQ(p2->Area(), 12.0);
+  pro::proxy<spec::InlineMetaShape> p3 = std::move(p2);
+  ASSERT_FALSE(p2.has_value());
+  ASSERT_EQ(p3->Area(), 12.0);
+  p3.reset();
+  ASSERT_FALSE(p3.has_value());
+}
+
+TEST(ProxyInvocationTests, TestHotConvention) {
+  static_assert(std::tuple_element_t<0u, spec::HotAreaShape::convention_types>::is_hot);
+  static_assert(!pro::details::is_conv_hot<std::tuple_element_t<1u, spec::HotAreaShape::convention_types>>());
+  static_assert(sizeof(pro::details::facade_traits<spec::HotAreaShape>::meta) ==
+      sizeof(pro::details::facade_traits<spec::Shape>::meta));
+  pro::proxy<spec::HotAreaShape> p1 = pro::make_proxy<spec::HotAreaShape, spec::Circle>("c", 1.0);
+  pro::proxy<spec::HotAreaShape> p2 = p1;
+  p2->Scale(2.0);
+  ASSERT_EQ(p1->Area(), 3.0);
+  ASSERT_EQ(p2->Area(), 12.0);
+  auto identity = pro::details::proxy_helper<spec::HotAreaShape>::get_identity(p1);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(identity) % pro::details::hot_meta_align, 0u);
+}
+
+TEST(ProxyInvocationTests, TestIndexedMeta) {
+  static_assert(sizeof(pro::proxy<spec::IndexedMetaCompactStringable>) == 8u);
+  pro::proxy<spec::IndexedMetaCompactStringable> p1 = pro::make_proxy<spec::IndexedMetaCompactStringable>(123);
+  pro::proxy<spec::IndexedMetaCompactStringable> p2 = pro::make_proxy<spec::IndexedMetaCompactStringable>(0.5f);
+  ASSERT_EQ(ToString(*p1), "123");
+  ASSERT_EQ(ToString(*p2), "0.500000");
+  p1 = std::move(p2);
+  ASSERT_FALSE(p2.has_value());
+  ASSERT_EQ(ToString(*p1), "0.500000");
+  p1.reset();
+  ASSERT_FALSE(p1.has_value());
+}
+
+TEST(ProxyInvocationTests, TestIndexedMeta_ConcurrentRegistration) {
+  // More types than the initial capacity of the meta table
+  auto make_all = []<int... Is>(std::integer_sequence<int, Is...>) {
+    return std::vector<pro::proxy<spec::IndexedMetaShape>>{
+        pro::make_proxy<spec::IndexedMetaShape>(spec::IndexedSquare<Is>{{Is * 1.0}})...};
+  };
+  std::vector<std::vector<pro::proxy<spec::IndexedMetaShape>>> results(4u);
+  std::vector<std::thread> threads;
+  for (auto& result : results) {
+    threads.emplace_back([&] { result = make_all(std::make_integer_sequence<int, 100>{}); });
+  }
+  for (auto& t : threads) { t.join(); }
+  for (auto& result : results) {
+    ASSERT_EQ(result.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_EQ(result[i]->Area(), 1.0 * i * i);
+      ASSERT_EQ(pro::details::proxy_helper<spec::IndexedMetaShape>::get_identity(result[i]),
+          pro::details::proxy_helper<spec::IndexedMetaShape>::get_identity(results[0][i]));
+    }
+  }
+}
+
+TEST(ProxyInvocationTests, TestEmbeddedMeta) {
+  static_assert(sizeof(pro::proxy<spec::EmbeddedMetaShape>) == sizeof(void*));
+  static_assert(!pro::inplace_proxiable_target<spec::Square, spec::EmbeddedMetaShape>);
+  static_assert(!pro::proxiable<std::unique_ptr<spec::Square>, spec::EmbeddedMetaShape>);
+  pro::proxy_vector<spec::EmbeddedMetaShape> v;
+  for (int i = 0; i < 10; ++i) {
+    v.push_back(pro::make_proxy<spec::EmbeddedMetaShape, spec::Square>(1.0 * i));
+    v.push_back(pro::make_proxy<spec::EmbeddedMetaShape, spec::Circle>("c", 1.0 * i));
+  }
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_EQ(v[i * 2]->Area(), 1.0 * i * i);
+    ASSERT_EQ(v[i * 2 + 1]->Area(), 3.0 * i * i);
+  }
+  using helper = pro::details::proxy_helper<spec::EmbeddedMetaShape>;
+  ASSERT_EQ(helper::get_identity(v[0]), helper::get_identity(v[2]));
+  ASSERT_NE(helper::get_identity(v[0]), helper::get_identity(v[1]));
+  auto p = v[3];
+  p->Scale(2.0);
+  ASSERT_EQ(p->Area(), 12.0);
+  ASSERT_EQ(v[3]->Area(), 3.0);
+  v.erase(v.begin());  // Relocates the remaining proxies without copying the objects
+  ASSERT_EQ(v[2]->Area(), 3.0);
+  pro::proxy<spec::EmbeddedMetaShape> empty;
+  ASSERT_FALSE(empty.has_value());
+  ASSERT_EQ(helper::get_identity(empty), nullptr);
+}
+
+TEST(ProxyInvocationTests, TestClosedFacade) {
+  auto p = pro::make_proxy<spec::ClosedShape, spec::Square>(2.0);
+  ASSERT_EQ(p->Area(), 4.0);
+  p = pro::make_proxy<spec::ClosedShape, spec::Circle>("c", 1.0);
+  ASSERT_EQ(p->Area(), 3.0);
+  auto p2 = p;
+  p->Scale(2.0);
+  ASSERT_EQ(p->Area(), 12.0);
+  ASSERT_EQ(p2->Area(), 3.0);
+  p.reset();
+  ASSERT_FALSE(p.has_value());
+}
+
+TEST(ProxyInvocationTests, TestClosedFacade_Batch) {
+  std::vector<pro::proxy<spec::ClosedShape>> data;
+  data.push_back(pro::make_proxy<spec::ClosedShape, spec::Circle>("c", 1.0));
+  data.push_back(pro::make_proxy<spec::ClosedShape, spec::Square>(1.0));
+  data.push_back(pro::make_proxy<spec::ClosedShape, spec::Square>(2.0));
+  using C = std::tuple_element_t<1u, spec::ClosedShape::convention_types>;
+  pro::proxy_invoke_batch<C, void(double)>(data, 2.0);
+  double total = 0.0;
+  for (auto& s : data) {
+    total += s->Area();
+  }
+  ASSERT_EQ(total, 32.0);
+}
+
+TEST(ProxyInvocationTests, TestVisit) {
+  pro::proxy<spec::ClosedShape> closed = pro::make_proxy<spec::ClosedShape, spec::Circle>("c", 1.0);
+  std::string visited = pro::proxy_visit<spec::Circle>(closed,
+      [](spec::Circle& c) { return c.name; },
+      [](pro::proxy<spec::ClosedShape>&) { return std::string{"fallback"}; });
+  ASSERT_EQ(visited, "c");
+
+  std::vector<pro::proxy<spec::Shape>> data;
+  data.push_back(pro::make_proxy<spec::Shape, spec::Square>(1.0));
+  data.push_back(pro::make_proxy<spec::Shape, spec::Circle>("c", 1.0));
+  data.push_back(pro::make_proxy<spec::Shape, spec::Circle>(std::string(100, 'x'), 1.0));  // Allocated
+  spec::Square square{2.0};
+  data.push_back(&square);
+  std::vector<std::string> results;
+  for (auto& p : data) {
+    results.push_back(pro::proxy_visit<spec::Square, spec::Circle>(p,
+        [](auto& v) {
+          if constexpr (std::is_same_v<std::decay_t<decltype(v)>, spec::Square>) {
+            return "square:" + std::to_string(v.Area());
+          } else {
+            return "circle:" + v.name.substr(0, 1);
+          }
+        },
+        [](pro::proxy<spec::Shape>& q) { return "other:" + std::to_string(q->Area()); }));
+  }
+  ASSERT_EQ(results, (std::vector<std::string>{"square:1.000000", "circle:c", "circle:x", "other:4.000000"}));
+}
+
+TEST(ProxyInvocationTests, TestVisit_Rvalue) {
+  auto p = pro::make_proxy<spec::Shape, spec::Circle>("hello", 1.0);
+  std::string moved;
+  pro::proxy_visit<spec::Circle>(std::move(p),
+      [&](spec::Circle&& c) { moved = std::move(c.name); },
+      [](pro::proxy<spec::Shape>&&) { FAIL(); });
+  ASSERT_EQ(moved, "hello");
+  pro::proxy<spec::Shape> empty;
+  bool fallback_called = false;
+  pro::proxy_visit<spec::Circle>(empty, [](spec::Circle&) { FAIL(); },
+      [&](pro::proxy<spec::Shape>& q) { fallback_called = !q.has_value(); });
+  ASSERT_TRUE(fallback_called);
+}
+
+TEST(ProxyInvocationTests, TestVisit_InlineMeta) {
+  // An inline meta does not identify the pointer type
+  auto visitable = [](auto& p) requires(requires {
+    pro::proxy_visit<spec::Circle>(p, [](spec::Circle&) {}, [](auto&) {}); }) {};
+  static_assert(std::is_invocable_v<decltype(visitable), pro::proxy<spec::Shape>&>);
+  static_assert(!std::is_invocable_v<decltype(visitable), pro::proxy<spec::InlineMetaShape>&>);
+}
+
+TEST(ProxyInvocationTests, TestProxyView) {
+  using View = pro::proxy_view<spec::ViewableShape>;
+  static_assert(sizeof(View) == 2 * sizeof(void*));
+  static_assert(std::is_trivially_copy_constructible_v<View>);
+  static_assert(std::is_trivially_copy_assignable_v<View>);
+  static_assert(std::is_trivially_destructible_v<View>);
+  static_assert(std::tuple_size_v<pro::details::observer_facade<spec::ViewableShape>::convention_types> == 2u);  // The rvalue convention is dropped
+  pro::proxy<spec::ViewableShape> p = pro::make_proxy<spec::ViewableShape, spec::ReleasableCircle>(spec::ReleasableCircle{{"c", 1.0}});
+  ASSERT_EQ(spec::ScaleAndMeasure(p), 12.0);
+  ASSERT_EQ(p->Area(), 12.0);
+  View v = p;
+  ASSERT_TRUE(v.has_value());
+  ASSERT_EQ(pro::proxy_typeid(v), pro::type_id_of<spec::ReleasableCircle>());
+  ASSERT_EQ(std::move(*p).Release(), "c");
+  p.reset();
+  ASSERT_FALSE(static_cast<View>(p).has_value());
+}
+
+TEST(ProxyInvocationTests, TestProxyView_FromReference) {
+  spec::Square square{2.0};
+  ASSERT_EQ(spec::ScaleAndMeasure(pro::make_proxy_view<spec::ViewableShape>(square)), 16.0);
+  ASSERT_EQ(square.side, 4.0);
+  const spec::Square& const_square = square;
+  static_assert(!ViewableAs<spec::ViewableShape, const spec::Square>);  // Scale is not const
+  struct AreaOnly : pro::facade_builder
+      ::add_convention<spec::MemArea, double() const>
+      ::build {};
+  pro::proxy_view<AreaOnly> v = pro::make_proxy_view<AreaOnly>(const_square);
+  ASSERT_EQ(v->Area(), 16.0);
+}
+
+TEST(ProxyInvocationTests, TestUpcast) {
+  static_assert(std::is_convertible_v<const pro::proxy<spec::ViewableShape>&, pro::proxy<spec::Shape>>);
+  static_assert(!std::is_convertible_v<const pro::proxy<spec::Shape>&, pro::proxy<spec::ViewableShape>>);
+  static_assert(!std::is_convertible_v<const pro::proxy<spec::InlineMetaShape>&, pro::proxy<spec::Shape>>);
+  static_assert(!std::is_convertible_v<const pro::proxy<spec::IndexedMetaShape>&, pro::proxy<spec::Shape>>);
+  static_assert(!std::is_convertible_v<const pro::proxy<spec::HotAreaShape>&, pro::proxy<spec::Shape>>);
+  static_assert(!std::is_convertible_v<const pro::proxy<spec::ClosedShape>&, pro::proxy<spec::Shape>>);
+  pro::proxy<spec::ViewableShape> p = pro::make_proxy<spec::ViewableShape, spec::ReleasableCircle>(spec::ReleasableCircle{{"c", 1.0}});
+  ASSERT_EQ(spec::Measure(p), 3.0);
+  pro::proxy<spec::Shape> copy = p;
+  ASSERT_EQ(&pro::details::proxy_helper<spec::Shape>::get_meta(copy),
+      &pro::details::proxy_helper<spec::ViewableShape>::get_meta(p));  // Shares the meta
+  pro::proxy_prefetch(copy);  // Finds the hook in the meta of the base
+  copy->Scale(2.0);
+  ASSERT_EQ(copy->Area(), 12.0);
+  ASSERT_EQ(p->Area(), 3.0);
+  pro::proxy<spec::Shape> moved = std::move(p);
+  ASSERT_FALSE(p.has_value());
+  ASSERT_EQ(moved->Area(), 3.0);
+  pro::proxy<spec::ViewableShape> empty;
+  ASSERT_FALSE(static_cast<pro::proxy<spec::Shape>>(empty).has_value());
+}
+
+TEST(ProxyInvocationTests, TestUpcast_View) {
+  pro::proxy<spec::ScalableShape> p = pro::make_proxy<spec::ScalableShape>(spec::Square{2.0});
+  pro::proxy_view<spec::ScalableShape> v = p;
+  pro::proxy_view<spec::AreaShape> area = v;
+  v->Scale(2.0);
+  ASSERT_EQ(area->Area(), 16.0);
+  pro::proxy<spec::AreaShape> base = std::move(p);
+  ASSERT_FALSE(p.has_value());
+  ASSERT_EQ(base->Area(), 16.0);
+}
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include <gtest/gtest.h>
+#include <memory>
 #include "proxy.h"
 #include "utils.h"
 
@@ -21,13 +22,31 @@ struct TestTrivialFacade : pro::facade_builder
     ::support_destruction<pro::constraint_level::trivial>
     ::build {};
 
+struct TestTriviallyRelocatableFacade : pro::facade_builder
+    ::add_facade<utils::spec::Stringable>
+    ::support_relocation<pro::constraint_level::trivial>
+    ::build {};
+
+struct TestCopyableFacade : pro::facade_builder
+    ::add_facade<utils::spec::Stringable>
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::build {};
+
+struct TestEmbeddedMetaFacade : pro::facade_builder
+    ::add_facade<utils::spec::Stringable>
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::support_embedded_meta
+    ::build {};
+
 struct TestRttiFacade : pro::facade_builder
     ::add_reflection<utils::RttiReflection>
     ::add_facade<TestFacade, true>
     ::build {};
 
-// Additional static asserts for upward conversion
-static_assert(!std::is_convertible_v<pro::proxy<TestTrivialFacade>, pro::proxy<utils::spec::Stringable>>);
+// Additional static asserts for upward conversion. Without it, a facade is only
+// converted to a base facade when its meta leads with the meta of the base
+static_assert(std::is_convertible_v<pro::proxy<TestTrivialFacade>, pro::proxy<utils::spec::Stringable>>);
+static_assert(!std::is_convertible_v<pro::proxy<TestEmbeddedMetaFacade>, pro::proxy<utils::spec::Stringable>>);
 static_assert(std::is_convertible_v<pro::proxy<TestRttiFacade>, pro::proxy<TestFacade>>);
 
 }  // namespace
@@ -228,6 +247,80 @@ TEST(ProxyLifetimeTests, TestMoveConstrction_FromValue_Trivial) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
+TEST(ProxyLifetimeTests, TestMoveConstrction_FromValue_TriviallyRelocatable) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<TestTriviallyRelocatableFacade, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyLifetimeTests, TestCopyConstrction_FromValue_TriviallyCopyable) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    utils::LifetimeTracker::Session session{ &tracker };
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    pro::proxy<TestCopyableFacade> p1 = &session;
+    auto p2 = p1;
+    auto p3 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_TRUE(p3.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_EQ(ToString(*p3), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyLifetimeTests, TestCopyConstrction_FromValue_EmbeddedMeta) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<TestEmbeddedMetaFacade, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = p1;
+    ASSERT_TRUE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_EQ(ToString(*p2), "Session 2");
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kCopyConstruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyLifetimeTests, TestMoveConstrction_FromValue_EmbeddedMeta) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<TestEmbeddedMetaFacade, utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    auto p2 = std::move(p1);
+    ASSERT_FALSE(p1.has_value());
+    ASSERT_TRUE(p2.has_value());
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+    p2.reset();
+    ASSERT_FALSE(p2.has_value());
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
 TEST(ProxyLifetimeTests, TestMoveConstrction_FromNull) {
   pro::proxy<TestFacade> p1;
   auto p2 = std::move(p1);
@@ -903,6 +996,47 @@ TEST(ProxyLifetimeTests, TestSwap_Value_Value) {
   ASSERT_TRUE(tracker.GetOperations() == expected_ops);
 }
 
+TEST(ProxyLifetimeTests, TestSwap_Value_Value_TriviallyRelocatable) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    auto p1 = pro::make_proxy<TestTriviallyRelocatableFacade, utils::LifetimeTracker::Session>(&tracker);
+    pro::proxy<TestTriviallyRelocatableFacade> p2 = std::make_unique<utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kValueConstruction);
+    swap(p1, p2);
+    ASSERT_EQ(ToString(*p1), "Session 2");
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
+TEST(ProxyLifetimeTests, TestSwap_Value_Value_TriviallyCopyable) {
+  utils::LifetimeTracker tracker;
+  std::vector<utils::LifetimeOperation> expected_ops;
+  {
+    utils::LifetimeTracker::Session session{ &tracker };
+    expected_ops.emplace_back(1, utils::LifetimeOperationType::kValueConstruction);
+    pro::proxy<TestCopyableFacade> p1 = &session;
+    pro::proxy<TestCopyableFacade> p2 = &session;
+    swap(p1, p2);
+    ASSERT_EQ(ToString(*p1), "Session 1");
+    ASSERT_EQ(ToString(*p2), "Session 1");
+    pro::proxy<TestCopyableFacade> p3 = std::make_shared<utils::LifetimeTracker::Session>(&tracker);
+    expected_ops.emplace_back(2, utils::LifetimeOperationType::kValueConstruction);
+    swap(p1, p3);
+    ASSERT_EQ(ToString(*p1), "Session 2");
+    ASSERT_EQ(ToString(*p3), "Session 1");
+    ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+  }
+  expected_ops.emplace_back(2, utils::LifetimeOperationType::kDestruction);
+  expected_ops.emplace_back(1, utils::LifetimeOperationType::kDestruction);
+  ASSERT_TRUE(tracker.GetOperations() == expected_ops);
+}
+
 TEST(ProxyLifetimeTests, TestSwap_Value_Self) {
   utils::LifetimeTracker tracker;
   std::vector<utils::LifetimeOperation> expected_ops;
@@ -3,7 +3,10 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <string>
 #include <typeinfo>
+#include <utility>
+#include <vector>
 #include "proxy.h"
 #include "utils.h"
 
@@ -65,3 +68,81 @@ TEST(ProxyReflectionTests, TestTraits_FancyPtr) {
   ASSERT_EQ(pro::proxy_reflect<TraitsReflection>(p).is_nothrow_destructible_, true);
   ASSERT_EQ(pro::proxy_reflect<TraitsReflection>(p).is_trivial_, false);
 }
+
+namespace {
+
+struct TestTypeidFacade : pro::facade_builder
+    ::support_copy<pro::constraint_level::nontrivial>
+    ::support_typeid
+    ::build {};
+
+struct TestTrivialTypeidFacade : pro::facade_builder
+    ::support_relocation<pro::constraint_level::trivial>
+    ::support_destruction<pro::constraint_level::trivial>
+    ::support_typeid
+    ::build {};
+
+}  // namespace
+
+TEST(ProxyReflectionTests, TestTypeid) {
+  int foo = 123;
+  pro::proxy<TestTypeidFacade> p;
+  ASSERT_EQ(pro::proxy_typeid(p), pro::type_id_of<void>());
+  p = &foo;
+  ASSERT_EQ(pro::proxy_typeid(p), pro::type_id_of<int>());
+  ASSERT_NE(pro::proxy_typeid(p), pro::type_id_of<int*>());
+  p = std::make_shared<const double>(1.5);
+  ASSERT_EQ(pro::proxy_typeid(p), pro::type_id_of<double>());
+  ASSERT_EQ(pro::proxy_typeid(p), pro::type_id_of<const double&>());
+  ASSERT_EQ(std::hash<pro::type_id>{}(pro::proxy_typeid(p)),
+      pro::type_id_of<double>().hash_code());
+  ASSERT_TRUE(pro::type_id_of<int>() < pro::type_id_of<double>() ||
+      pro::type_id_of<double>() < pro::type_id_of<int>());
+}
+
+TEST(ProxyReflectionTests, TestProxyCast_Pointer) {
+  int foo = 123;
+  pro::proxy<TestTypeidFacade> p = &foo;
+  ASSERT_EQ(pro::proxy_cast<int>(&p), &foo);
+  ASSERT_EQ(pro::proxy_cast<const int>(&p), &foo);
+  ASSERT_EQ(pro::proxy_cast<double>(&p), nullptr);
+  const pro::proxy<TestTypeidFacade>& cp = p;
+  ASSERT_EQ(pro::proxy_cast<int>(&cp), &foo);
+  p = std::make_shared<const double>(1.5);
+  ASSERT_EQ(pro::proxy_cast<double>(&p), nullptr);
+  ASSERT_EQ(*pro::proxy_cast<const double>(&p), 1.5);
+  p.reset();
+  ASSERT_EQ(pro::proxy_cast<int>(&p), nullptr);
+  ASSERT_EQ(pro::proxy_cast<int>(static_cast<pro::proxy<TestTypeidFacade>*>(nullptr)), nullptr);
+}
+
+TEST(ProxyReflectionTests, TestProxyCast_Value) {
+  pro::proxy<TestTypeidFacade> p = pro::make_proxy<TestTypeidFacade, std::string>("hello");
+  ASSERT_EQ(pro::proxy_cast<std::string>(p), "hello");
+  pro::proxy_cast<std::string&>(p) += " world";
+  ASSERT_EQ(pro::proxy_cast<const std::string&>(std::as_const(p)), "hello world");
+  std::string moved = pro::proxy_cast<std::string>(std::move(p));
+  ASSERT_EQ(moved, "hello world");
+  ASSERT_THROW(pro::proxy_cast<int>(p), pro::bad_proxy_cast);
+}
+
+TEST(ProxyReflectionTests, TestProxyCast_TrivialFacade) {
+  // Checking whether a proxy is proxiable as its own pointer type must not be
+  // a hard error, since a proxy has no dereferenceable element
+  static_assert(!pro::proxiable<pro::proxy<TestTrivialTypeidFacade>, TestTrivialTypeidFacade>);
+  std::vector<pro::proxy<TestTrivialTypeidFacade>> proxies;
+  proxies.push_back(pro::make_proxy<TestTrivialTypeidFacade>(123));
+  ASSERT_EQ(*pro::proxy_cast<int>(&proxies[0]), 123);
+}
+
+TEST(ProxyReflectionTests, TestProxyCast_CopyOnWrite) {
+  auto p1 = pro::make_proxy_cow<TestTypeidFacade, std::string>("hello");
+  auto p2 = p1;
+  const std::string* shared = &pro::proxy_cast<const std::string&>(std::as_const(p1));
+  ASSERT_EQ(&pro::proxy_cast<const std::string&>(std::as_const(p2)), shared);
+  ASSERT_EQ(pro::proxy_cast<const std::string>(&p2), shared);  // Not unshared
+  pro::proxy_cast<std::string&>(p2) += " world";
+  ASSERT_NE(pro::proxy_cast<const std::string>(&p2), shared);
+  ASSERT_EQ(pro::proxy_cast<const std::string&>(std::as_const(p1)), "hello");
+  ASSERT_EQ(pro::proxy_cast<const std::string&>(std::as_const(p2)), "hello world");
+}
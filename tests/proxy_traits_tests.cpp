@@ -2,7 +2,9 @@
 // Licensed under the MIT License.
 
 #include <array>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include "proxy.h"
 #include "utils.h"
@@ -73,6 +75,11 @@ static_assert(std::is_nothrow_constructible_v<pro::proxy<DefaultFacade>, MockFun
 static_assert(std::is_nothrow_assignable_v<pro::proxy<DefaultFacade>, MockFunctionPtr>);
 static_assert(sizeof(pro::proxy<DefaultFacade>) == 4 * sizeof(void*));  // VTABLE should be embeded
 
+struct OutOfLineMetaFacade : pro::facade_builder::support_inline_meta<0u>::build {};
+static_assert(sizeof(pro::proxy<OutOfLineMetaFacade>) == 3 * sizeof(void*));  // VTABLE should be out of line
+static_assert(std::is_nothrow_move_constructible_v<pro::proxy<OutOfLineMetaFacade>>);
+static_assert(pro::proxiable<MockMovablePtr, OutOfLineMetaFacade>);
+
 struct CopyableFacade : pro::facade_builder
     ::support_copy<pro::constraint_level::nontrivial>
     ::build {};
@@ -154,6 +161,36 @@ static_assert(std::is_nothrow_constructible_v<pro::proxy<TrivialFacade>, MockFun
 static_assert(std::is_nothrow_assignable_v<pro::proxy<TrivialFacade>, MockFunctionPtr>);
 static_assert(sizeof(pro::proxy<TrivialFacade>) == 2 * sizeof(void*));  // VTABLE should be eliminated, but a placeholder is required
 
+struct OptInTrivialPtr {
+  OptInTrivialPtr(OptInTrivialPtr&&) noexcept {}
+  const OptInTrivialPtr* operator->() const noexcept { return this; }
+};
+
+}  // namespace
+
+template <>
+struct pro::is_trivially_relocatable<OptInTrivialPtr> : std::true_type {};
+
+namespace {
+
+struct TriviallyRelocatableFacade : pro::facade_builder
+    ::support_relocation<pro::constraint_level::trivial>
+    ::build {};
+static_assert(!std::is_copy_constructible_v<pro::proxy<TriviallyRelocatableFacade>>);
+static_assert(std::is_nothrow_move_constructible_v<pro::proxy<TriviallyRelocatableFacade>>);
+static_assert(!std::is_trivially_move_constructible_v<pro::proxy<TriviallyRelocatableFacade>>);
+static_assert(pro::is_trivially_relocatable_v<MockTrivialPtr>);
+static_assert(!pro::is_trivially_relocatable_v<MockMovablePtr>);
+static_assert(pro::is_trivially_relocatable_v<OptInTrivialPtr>);
+static_assert(pro::is_trivially_relocatable_v<std::unique_ptr<std::string>>);
+static_assert(pro::is_trivially_relocatable_v<std::shared_ptr<std::string>>);
+static_assert(!pro::proxiable<MockMovablePtr, TriviallyRelocatableFacade>);
+static_assert(pro::proxiable<MockTrivialPtr, TriviallyRelocatableFacade>);
+static_assert(pro::proxiable<OptInTrivialPtr, TriviallyRelocatableFacade>);
+static_assert(pro::proxiable<std::unique_ptr<std::string>, TriviallyRelocatableFacade>);
+static_assert(pro::proxiable<std::shared_ptr<std::string>, TriviallyRelocatableFacade>);
+static_assert(std::is_nothrow_constructible_v<pro::proxy<TriviallyRelocatableFacade>, std::unique_ptr<std::string>>);
+
 struct ReflectionOfSmallPtr {
   template <class P> requires(sizeof(P) <= sizeof(void*))
   constexpr ReflectionOfSmallPtr(std::in_place_type_t<P>) {}
@@ -352,4 +389,81 @@ static_assert(pro::facade<FacadeWithSizeOfNonPowerOfTwo>);
 static_assert(FacadeWithSizeOfNonPowerOfTwo::constraints.max_size == 6u);
 static_assert(FacadeWithSizeOfNonPowerOfTwo::constraints.max_align == 2u);
 
+struct ClosedFacade : pro::facade_builder
+    ::restrict_types<int, double, std::array<char, 24u>>
+    ::build {};
+static_assert(pro::facade<ClosedFacade>);
+static_assert(std::is_same_v<ClosedFacade::restricted_types, std::tuple<int, double, std::array<char, 24u>>>);
+static_assert(ClosedFacade::constraints.max_size == 24u);  // Fitted to the restricted types
+static_assert(ClosedFacade::constraints.max_align == alignof(double));
+static_assert(pro::inplace_proxiable_target<int, ClosedFacade>);
+static_assert(pro::inplace_proxiable_target<std::array<char, 24u>, ClosedFacade>);
+static_assert(!pro::inplace_proxiable_target<float, ClosedFacade>);  // Not in the restricted types
+static_assert(!pro::proxiable<int*, ClosedFacade>);
+static_assert(sizeof(pro::proxy<ClosedFacade>) == 32u);  // A type index instead of a meta pointer
+
+struct ClosedFacadeWithLayout : pro::facade_builder
+    ::restrict_types<char, int>
+    ::restrict_layout<sizeof(void*)>
+    ::build {};
+static_assert(ClosedFacadeWithLayout::constraints.max_size == sizeof(void*));
+static_assert(sizeof(pro::proxy<ClosedFacadeWithLayout>) == 2 * sizeof(void*));
+
+struct ClosedFacadeWithLargerLayout : pro::facade_builder
+    ::restrict_types<char>
+    ::restrict_layout<2u * sizeof(void*)>
+    ::build {};
+static_assert(ClosedFacadeWithLargerLayout::constraints.max_size == 2u * sizeof(void*));  // Not fitted to char
+
+struct ExpandedFacade : pro::facade_builder
+    ::expand_layout<6u * sizeof(void*)>
+    ::build {};
+static_assert(ExpandedFacade::constraints.max_size == 6u * sizeof(void*));
+static_assert(ExpandedFacade::constraints.max_align == alignof(void*));
+static_assert(sizeof(pro::proxy<ExpandedFacade>) == 8 * sizeof(void*));  // With 2 dispatchers inline
+static_assert(pro::inplace_proxiable_target<std::array<void*, 6u>, ExpandedFacade>);
+static_assert(!pro::inplace_proxiable_target<std::array<void*, 7u>, ExpandedFacade>);
+
+struct ExpandedFacadeWithAlignment : pro::facade_builder
+    ::restrict_layout<sizeof(void*)>
+    ::expand_layout<sizeof(void*), 4u * alignof(void*)>
+    ::build {};
+static_assert(ExpandedFacadeWithAlignment::constraints.max_size == 4u * alignof(void*));  // Rounded up to the alignment
+static_assert(ExpandedFacadeWithAlignment::constraints.max_align == 4u * alignof(void*));
+
+struct ExpandedFacadeNotShrunk : pro::facade_builder
+    ::expand_layout<1u>
+    ::build {};
+static_assert(ExpandedFacadeNotShrunk::constraints.max_size == 2 * sizeof(void*));
+static_assert(ExpandedFacadeNotShrunk::constraints.max_align == alignof(void*));
+
+struct ExpandedFacadeRestricted : pro::facade_builder
+    ::expand_layout<8u * sizeof(void*)>
+    ::restrict_layout<4u * sizeof(void*)>
+    ::build {};
+static_assert(ExpandedFacadeRestricted::constraints.max_size == 4u * sizeof(void*));
+
+struct alignas(64) CacheLineCounter { long value; };
+struct CacheLineFacade : pro::facade_builder
+    ::expand_layout<64u, 64u>
+    ::build {};
+static_assert(CacheLineFacade::constraints.max_size == 64u);
+static_assert(CacheLineFacade::constraints.max_align == 64u);
+static_assert(alignof(pro::proxy<CacheLineFacade>) == 64u);
+static_assert(pro::inplace_proxiable_target<CacheLineCounter, CacheLineFacade>);
+static_assert(!pro::inplace_proxiable_target<CacheLineCounter, DefaultFacade>);
+
+struct CacheLineFacadeRestricted : pro::facade_builder
+    ::expand_layout<256u, 256u>
+    ::restrict_layout<128u, 64u>
+    ::build {};
+static_assert(CacheLineFacadeRestricted::constraints.max_size == 128u);
+static_assert(CacheLineFacadeRestricted::constraints.max_align == 64u);
+
+struct CacheLineFacadeImpliedAlign : pro::facade_builder
+    ::expand_layout<256u, 256u>
+    ::restrict_layout<128u>
+    ::build {};
+static_assert(CacheLineFacadeImpliedAlign::constraints.max_align == alignof(std::max_align_t));  // Over-alignment is never implied
+
 }  // namespace